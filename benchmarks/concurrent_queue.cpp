@@ -0,0 +1,162 @@
+#include "../srcs/concurrent_queue/concurrent_queue.hpp"
+#include "../srcs/queue/queue.hpp"
+#include "../tests/catch.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// a mutex-wrapped ft::queue, the usual worker pool queue. a blocked side
+// yields its time slice, the threads may outnumber the cores
+template <class T>
+class locked_queue
+{
+    public:
+        bool try_push (const T& val)
+        {
+            std::lock_guard<std::mutex> lock (_mutex);
+            _queue.push(val);
+            return true;
+        }
+
+        bool try_pop (T& val)
+        {
+            std::lock_guard<std::mutex> lock (_mutex);
+            if (_queue.empty())
+                return false;
+            val = _queue.front();
+            _queue.pop();
+            return true;
+        }
+
+    private:
+        std::mutex _mutex;
+        ft::queue<T> _queue;
+};
+
+/* SCALING */
+// n messages cross the queue, a single thread alternates pushes & pops,
+// more threads are split between producers & consumers
+template <class Queue>
+static long fan (Queue& q, int threads, int n)
+{
+    if (threads == 1) {
+        long sum = 0;
+        for (int i = 0; i < n; ++i) {
+            int val = 0;
+            q.try_push(i);
+            q.try_pop(val);
+            sum += val;
+        }
+        return sum;
+    }
+    int producers = threads / 2;
+    std::atomic<long> sum (0);
+    std::atomic<int> received (0);
+    std::vector<std::thread> workers;
+    for (int p = 0; p < producers; ++p) {
+        workers.push_back(std::thread([&q, p, producers, n]() {
+            for (int i = p; i < n; i += producers) {
+                while (!q.try_push(i))
+                    std::this_thread::yield();
+            }
+        }));
+    }
+    for (int c = producers; c < threads; ++c) {
+        workers.push_back(std::thread([&q, &sum, &received, n]() {
+            long local = 0;
+            while (received.load(std::memory_order_relaxed) < n) {
+                int val;
+                if (q.try_pop(val)) {
+                    local += val;
+                    received.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                    std::this_thread::yield();
+            }
+            sum += local;
+        }));
+    }
+    for (size_t i = 0; i < workers.size(); ++i)
+        workers[i].join();
+    return sum;
+}
+
+// the consumers park on the queue & drain it by batches, it needs at least
+// two threads
+static long fan_bulk (ft::concurrent_queue<int>& q, int threads, int n)
+{
+    int producers = threads / 2;
+    int consumers = threads - producers;
+    std::atomic<int> received (0);
+    std::vector<std::thread> workers;
+    for (int p = 0; p < producers; ++p) {
+        workers.push_back(std::thread([&q, p, producers, n]() {
+            for (int i = p; i < n; i += producers)
+                q.push(i);
+        }));
+    }
+    // a consumer stops once all messages have arrived, the last ones are
+    // woken by one poison message per consumer
+    std::atomic<long> sum (0);
+    for (int c = 0; c < consumers; ++c) {
+        workers.push_back(std::thread([&q, &sum, &received, n]() {
+            ft::vector<int> bulk;
+            long local = 0;
+            for (;;) {
+                int val;
+                q.pop(val);
+                if (val < 0)
+                    break ;
+                bulk.clear();
+                bulk.push_back(val);
+                q.pop_bulk(bulk, 63);
+                for (size_t i = 0; i < bulk.size(); ++i)
+                    local += bulk[i];
+                if (received.fetch_add(bulk.size()) + static_cast<int>(bulk.size()) == n)
+                    break ;
+            }
+            sum += local;
+        }));
+    }
+    while (received.load() < n)
+        std::this_thread::yield();
+    for (int c = 0; c < consumers; ++c)
+        q.try_push(-1);
+    for (size_t i = 0; i < workers.size(); ++i)
+        workers[i].join();
+    int poison;
+    while (q.try_pop(poison))
+        ;
+    return sum;
+}
+
+TEST_CASE("concurrent_queue scaling from 1 to 64 threads", "[!benchmark][concurrent_queue]")
+{
+    static const int n = 200000;
+    static const int thread_counts[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+    for (size_t i = 0; i < sizeof(thread_counts) / sizeof(*thread_counts); ++i) {
+        int threads = thread_counts[i];
+        std::string suffix = " threads=" + std::to_string(threads) + " n=200000";
+
+        BENCHMARK("ft::concurrent_queue" + suffix) {
+            ft::concurrent_queue<int> q (1024);
+            return fan(q, threads, n);
+        };
+
+        if (threads > 1) {
+            BENCHMARK("ft::concurrent_queue blocking & pop_bulk" + suffix) {
+                ft::concurrent_queue<int> q (1024);
+                return fan_bulk(q, threads, n);
+            };
+        }
+
+        BENCHMARK("mutex + ft::queue" + suffix) {
+            locked_queue<int> q;
+            return fan(q, threads, n);
+        };
+    }
+}
@@ -0,0 +1,320 @@
+#include "../srcs/deque/deque.hpp"
+#include "../srcs/vector/vector.hpp"
+#include "../tests/catch.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+/* PUSH */
+// sustained pushes at one end, the map has to grow again & again
+TEST_CASE("deque push throughput", "[!benchmark][deque]")
+{
+    static const int sizes[] = { 1000000, 10000000, 100000000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        int n = sizes[s];
+        BENCHMARK("ft::deque push_back n=" + std::to_string(n)) {
+            ft::deque<int> dq;
+            for (int i = 0; i < n; ++i)
+                dq.push_back(i);
+            return dq.size();
+        };
+        BENCHMARK("ft::deque push_front n=" + std::to_string(n)) {
+            ft::deque<int> dq;
+            for (int i = 0; i < n; ++i)
+                dq.push_front(i);
+            return dq.size();
+        };
+        BENCHMARK("std::deque push_back n=" + std::to_string(n)) {
+            std::deque<int> dq;
+            for (int i = 0; i < n; ++i)
+                dq.push_back(i);
+            return dq.size();
+        };
+    }
+}
+
+// a fifo which keeps about the same size, the map is recentered
+TEST_CASE("deque sliding window", "[!benchmark][deque]")
+{
+    static const int n = 10000000;
+
+    BENCHMARK("ft::deque push_back & pop_front n=10000000") {
+        ft::deque<int> dq;
+        for (int i = 0; i < n; ++i) {
+            dq.push_back(i);
+            if (dq.size() > 1000)
+                dq.pop_front();
+        }
+        return dq.size();
+    };
+}
+
+/* INSERT */
+// an edit buffer, elements are inserted near its front or in its middle
+// then erased again so the deque keeps its size
+template <class Deque>
+static void bench_insert (const std::string& name, int n)
+{
+    Deque dq (n, 42);
+    BENCHMARK(name + " insert & erase 10 near the front n=" + std::to_string(n)) {
+        for (int i = 0; i < 10; ++i)
+            dq.insert(dq.begin() + 10, i);
+        dq.erase(dq.begin() + 10, dq.begin() + 20);
+        return dq.size();
+    };
+    BENCHMARK(name + " insert & erase 10 in the middle n=" + std::to_string(n)) {
+        for (int i = 0; i < 10; ++i)
+            dq.insert(dq.begin() + n / 2, i);
+        dq.erase(dq.begin() + n / 2, dq.begin() + n / 2 + 10);
+        return dq.size();
+    };
+    BENCHMARK(name + " insert & erase 1000 copies in the middle n=" + std::to_string(n)) {
+        dq.insert(dq.begin() + n / 2, 1000, 7);
+        dq.erase(dq.begin() + n / 2, dq.begin() + n / 2 + 1000);
+        return dq.size();
+    };
+}
+
+TEST_CASE("deque insert", "[!benchmark][deque]")
+{
+    static const int sizes[] = { 1000, 100000, 1000000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        bench_insert<ft::deque<int> >("ft::deque", sizes[s]);
+        bench_insert<std::deque<int> >("std::deque", sizes[s]);
+    }
+}
+
+/* SEGMENTED ALGORITHMS */
+struct summer
+{
+    long sum;
+
+    summer (void) : sum(0) {}
+    void operator() (int x) { sum += x; }
+};
+
+// the ft algorithms split a deque into its chunks, the std ones step
+// through its iterators
+template <class Deque>
+static void bench_segmented (int n)
+{
+    Deque src;
+    for (int i = 0; i < n; ++i)
+        src.push_back(i);
+    Deque dst (src);
+    std::string size = " n=" + std::to_string(n);
+
+    BENCHMARK("ft::for_each over ft::deque" + size) {
+        return ft::for_each(src.begin(), src.end(), summer()).sum;
+    };
+    BENCHMARK("std::for_each over ft::deque" + size) {
+        return std::for_each(src.begin(), src.end(), summer()).sum;
+    };
+    BENCHMARK("ft::find over ft::deque" + size) {
+        return ft::find(src.begin(), src.end(), -1) == src.end();
+    };
+    BENCHMARK("std::find over ft::deque" + size) {
+        return std::find(src.begin(), src.end(), -1) == src.end();
+    };
+    BENCHMARK("ft::fill over ft::deque" + size) {
+        ft::fill(dst.begin(), dst.end(), 42);
+        return dst.size();
+    };
+    BENCHMARK("std::fill over ft::deque" + size) {
+        std::fill(dst.begin(), dst.end(), 42);
+        return dst.size();
+    };
+    BENCHMARK("ft::copy between ft::deques" + size) {
+        return ft::copy(src.begin(), src.end(), dst.begin()) == dst.end();
+    };
+    BENCHMARK("std::copy between ft::deques" + size) {
+        return std::copy(src.begin(), src.end(), dst.begin()) == dst.end();
+    };
+    BENCHMARK("ft::deque operator==" + size) {
+        return src == dst;
+    };
+    BENCHMARK("std::equal over ft::deque" + size) {
+        return std::equal(src.begin(), src.end(), dst.begin());
+    };
+}
+
+// the ft algorithms split a deque into its chunks, the std ones step
+// through its iterators
+TEST_CASE("deque segmented algorithms", "[!benchmark][deque]")
+{
+    bench_segmented<ft::deque<int> >(100000);
+    bench_segmented<ft::deque<int> >(10000000);
+}
+
+/* RANDOM ACCESS */
+// sums the elements at pseudo random indices, then walks a sliding window
+// of indices over the container
+template <class Container>
+static void bench_random_access (const std::string& name, int n)
+{
+    Container cnt;
+    for (int i = 0; i < n; ++i)
+        cnt.push_back(i);
+    const Container& ccnt = cnt;
+    std::vector<size_t> indices (1000000);
+    size_t seed = 0;
+    for (size_t k = 0; k < indices.size(); ++k) {
+        seed = seed * 1103515245 + 12345;
+        indices[k] = (seed >> 16) % n;
+    }
+
+    BENCHMARK(name + " operator[] at random indices n=" + std::to_string(n)) {
+        long sum = 0;
+        for (size_t k = 0; k < indices.size(); ++k)
+            sum += ccnt[indices[k]];
+        return sum;
+    };
+    BENCHMARK(name + " operator[] over a window n=" + std::to_string(n)) {
+        long sum = 0;
+        for (int start = 0; start + 64 <= n && start < 100000; start += 16) {
+            for (int i = 0; i < 64; ++i)
+                sum += ccnt[start + i];
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("deque random access", "[!benchmark][deque]")
+{
+    static const int sizes[] = { 10000, 1000000, 10000000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        bench_random_access<ft::deque<int> >("ft::deque", sizes[s]);
+        bench_random_access<std::deque<int> >("std::deque", sizes[s]);
+        bench_random_access<ft::vector<int> >("ft::vector", sizes[s]);
+    }
+}
+
+/* APPEND */
+struct record
+{
+    long id;
+    double values[7];
+};
+
+// batches of 4096 records from an ft::vector, 400K records
+TEST_CASE("deque append batches", "[!benchmark][deque]")
+{
+    static const int batch = 4096;
+    static const int batches = 100;
+    ft::vector<record> src (batch);
+    for (int i = 0; i < batch; ++i)
+        src[i].id = i;
+
+    BENCHMARK("ft::deque append 100 batches of 4096 records") {
+        ft::deque<record> dq;
+        for (int b = 0; b < batches; ++b)
+            dq.append(src.begin(), src.end());
+        return dq.size();
+    };
+    BENCHMARK("ft::deque push_back 100 batches of 4096 records") {
+        ft::deque<record> dq;
+        for (int b = 0; b < batches; ++b) {
+            for (int i = 0; i < batch; ++i)
+                dq.push_back(src[i]);
+        }
+        return dq.size();
+    };
+    BENCHMARK("std::deque insert 100 batches of 4096 records") {
+        std::deque<record> dq;
+        for (int b = 0; b < batches; ++b)
+            dq.insert(dq.end(), src.begin(), src.end());
+        return dq.size();
+    };
+    BENCHMARK("ft::deque push_back_n 409600 ints") {
+        ft::deque<int> dq;
+        dq.push_back_n(batch * batches, 42);
+        return dq.size();
+    };
+    BENCHMARK("ft::deque push_back 409600 ints") {
+        ft::deque<int> dq;
+        for (int i = 0; i < batch * batches; ++i)
+            dq.push_back(42);
+        return dq.size();
+    };
+}
+
+// many fifos of which few are ever used, an empty deque holds no chunk
+TEST_CASE("deque many small fifos", "[!benchmark][deque]")
+{
+    static const int n = 10000;
+
+    BENCHMARK("ft::deque 10000 fifos, 1 in 16 used") {
+        std::vector<ft::deque<int> > fifos (n);
+        for (int i = 0; i < n; i += 16) {
+            fifos[i].push_back(i);
+            fifos[i].pop_front();
+        }
+        return fifos.size();
+    };
+    BENCHMARK("std::deque 10000 fifos, 1 in 16 used") {
+        std::vector<std::deque<int> > fifos (n);
+        for (int i = 0; i < n; i += 16) {
+            fifos[i].push_back(i);
+            fifos[i].pop_front();
+        }
+        return fifos.size();
+    };
+}
+
+/* CHUNK SIZE */
+template <size_t Bytes>
+struct blob
+{
+    char data[Bytes];
+};
+
+template <class Deque>
+static void bench_chunk (const std::string& name, int n)
+{
+    typedef typename Deque::value_type value_type;
+
+    BENCHMARK(name + " push_back n=" + std::to_string(n)) {
+        Deque dq;
+        value_type v = value_type();
+        for (int i = 0; i < n; ++i)
+            dq.push_back(v);
+        return dq.size();
+    };
+
+    Deque dq;
+    value_type v = value_type();
+    for (int i = 0; i < n; ++i)
+        dq.push_back(v);
+    BENCHMARK(name + " iterate n=" + std::to_string(n)) {
+        size_t sum = 0;
+        for (typename Deque::iterator it = dq.begin(); it != dq.end(); ++it)
+            sum += it->data[0];
+        return sum;
+    };
+}
+
+template <class T>
+static void bench_chunk_policies (const std::string& type, int n)
+{
+    typedef std::allocator<T> A;
+
+    bench_chunk<ft::deque<T, A, ft::chunk_elements<32> > >("ft::deque<" + type + "> 32 elements", n);
+    bench_chunk<ft::deque<T, A, ft::chunk_bytes<512> > >("ft::deque<" + type + "> 512B", n);
+    bench_chunk<ft::deque<T, A, ft::chunk_bytes<4096> > >("ft::deque<" + type + "> 4KB", n);
+    bench_chunk<ft::deque<T, A, ft::chunk_bytes<16384> > >("ft::deque<" + type + "> 16KB", n);
+    bench_chunk<ft::deque<T, A, ft::chunk_bytes<65536> > >("ft::deque<" + type + "> 64KB", n);
+}
+
+// chunk policy x element size, the old deque held 32 elements per chunk
+TEST_CASE("deque chunk size", "[!benchmark][deque]")
+{
+    bench_chunk_policies<blob<4> >("4B", 4000000);
+    bench_chunk_policies<blob<16> >("16B", 1000000);
+    bench_chunk_policies<blob<64> >("64B", 250000);
+    bench_chunk_policies<blob<256> >("256B", 60000);
+}
@@ -0,0 +1,88 @@
+#include "../srcs/intrusive_list/intrusive_list.hpp"
+#include "../srcs/intrusive_avl_set/intrusive_avl_set.hpp"
+#include "../srcs/list/list.hpp"
+#include "../srcs/map/map.hpp"
+#include "../tests/catch.hpp"
+
+#include <random> // std::mt19937
+#include <vector>
+
+static std::vector<int> random_keys (int n, int range)
+{
+    std::mt19937 gen (42);
+    std::vector<int> v (n);
+    for (int i = 0; i < n; ++i)
+        v[i] = gen() % range;
+    return v;
+}
+
+static const int key_range = 20000;
+static const size_t capacity = 10000;
+
+/* LRU CACHE */
+// about half of the accesses hit, a hit moves the entry to the front & a
+// miss evicts the back entry. the owning containers allocate a list node
+// & a map node per miss, the intrusive ones link hooks embedded in
+// preallocated entries & unlink the evicted one without a lookup
+struct entry
+{
+    int key;
+    ft::list_hook lru;
+    ft::avl_set_hook by_key;
+
+    bool operator< (const entry& other) const { return key < other.key; }
+};
+
+TEST_CASE("lru cache", "[!benchmark][intrusive]")
+{
+    std::vector<int> keys = random_keys(1000000, key_range);
+
+    BENCHMARK("ft::list & ft::map lru accesses n=1000000") {
+        typedef ft::list<int> lru_list;
+        ft::map<int, lru_list::iterator> index;
+        lru_list lru;
+        size_t hits = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            ft::map<int, lru_list::iterator>::iterator it = index.find(keys[i]);
+            if (it != index.end()) {
+                lru.splice(lru.begin(), lru, it->second);
+                ++hits;
+                continue ;
+            }
+            if (lru.size() == capacity) {
+                index.erase(lru.back());
+                lru.pop_back();
+            }
+            lru.push_front(keys[i]);
+            index.insert(std::make_pair(keys[i], lru.begin()));
+        }
+        return hits;
+    };
+
+    std::vector<entry> entries (key_range);
+    BENCHMARK("ft::intrusive_list & ft::intrusive_avl_set lru accesses n=1000000") {
+        ft::intrusive_avl_set<entry, &entry::by_key> index;
+        ft::intrusive_list<entry, &entry::lru> lru;
+        size_t hits = 0;
+        entry probe;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            probe.key = keys[i];
+            ft::intrusive_avl_set<entry, &entry::by_key>::iterator it = index.find(probe);
+            if (it != index.end()) {
+                lru.splice(lru.begin(), lru, lru.iterator_to(*it));
+                ++hits;
+                continue ;
+            }
+            if (lru.size() == capacity) {
+                entry& victim = lru.back();
+                lru.pop_back();
+                index.unlink(victim);
+            }
+            entry& e = entries[keys[i]];
+            e.key = keys[i];
+            lru.push_front(e);
+            index.insert(e);
+        }
+        return hits;
+    };
+}
@@ -0,0 +1,79 @@
+#include "../srcs/list/list.hpp"
+#include "../tests/catch.hpp"
+
+#include <algorithm> // std::shuffle
+#include <list>
+#include <random> // std::mt19937
+#include <string>
+#include <vector>
+
+/* SORT */
+// every run assigns the input before sorting it, the assign rows give the
+// part of the time which is not spent sorting
+template <class List>
+static void bench_sort (const std::string& name, const std::vector<int>& input)
+{
+    List cnt (input.begin(), input.end());
+
+    BENCHMARK(name + " assign") {
+        cnt.assign(input.begin(), input.end());
+        return cnt.size();
+    };
+    BENCHMARK(name + " assign & sort") {
+        cnt.assign(input.begin(), input.end());
+        cnt.sort();
+        return cnt.front();
+    };
+}
+
+TEST_CASE("list sort", "[!benchmark][list]")
+{
+    static const int n = 1000000;
+    std::vector<int> sorted (n);
+    for (int i = 0; i < n; ++i)
+        sorted[i] = i;
+    std::vector<int> reversed (sorted.rbegin(), sorted.rend());
+    std::vector<int> shuffled (sorted);
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+
+    bench_sort< ft::list<int> >("ft::list random n=1000000", shuffled);
+    bench_sort< std::list<int> >("std::list random n=1000000", shuffled);
+    bench_sort< ft::list<int> >("ft::list presorted n=1000000", sorted);
+    bench_sort< std::list<int> >("std::list presorted n=1000000", sorted);
+    bench_sort< ft::list<int> >("ft::list reverse sorted n=1000000", reversed);
+    bench_sort< std::list<int> >("std::list reverse sorted n=1000000", reversed);
+}
+
+/* RELINKING */
+template <class List>
+static void bench_relinking (const std::string& name)
+{
+    static const int n = 1000000;
+    List cnt;
+    List other;
+    for (int i = 0; i < n; ++i)
+        cnt.push_back(i);
+
+    BENCHMARK(name + " splice whole list n=1000000") {
+        other.splice(other.end(), cnt);
+        cnt.splice(cnt.end(), other);
+        return cnt.size();
+    };
+    BENCHMARK(name + " reverse n=1000000") {
+        cnt.reverse();
+        return cnt.front();
+    };
+    BENCHMARK(name + " merge halves n=1000000") {
+        typename List::iterator mid = cnt.begin();
+        std::advance(mid, n / 2);
+        other.splice(other.end(), cnt, mid, cnt.end());
+        cnt.merge(other);
+        return cnt.size();
+    };
+}
+
+TEST_CASE("list relinking", "[!benchmark][list]")
+{
+    bench_relinking< ft::list<int> >("ft::list");
+    bench_relinking< std::list<int> >("std::list");
+}
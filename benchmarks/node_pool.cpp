@@ -0,0 +1,92 @@
+#include "../srcs/utils/node_pool.hpp"
+#include "../srcs/map/map.hpp"
+#include "../srcs/list/list.hpp"
+#include "../tests/catch.hpp"
+
+#include <cstdlib> // rand
+
+typedef ft::map<int, int> std_map;
+typedef ft::map<int, int, std::less<int>, ft::node_pool<std::pair<const int, int> > > pool_map;
+typedef ft::list<int> std_list;
+typedef ft::list<int, ft::node_pool<int> > pool_list;
+
+/* INSERT HEAVY */
+template <class Map>
+size_t fill_map (Map& map, int n)
+{
+    for (int i = 0; i < n; ++i)
+        map.insert(std::make_pair(rand(), i));
+    return map.size();
+}
+
+TEST_CASE("node_pool vs std::allocator insert heavy", "[!benchmark][node_pool]")
+{
+    static const int n = 1000000;
+
+    BENCHMARK("map insert std::allocator n=1000000") {
+        std_map map;
+        return fill_map(map, n);
+    };
+    BENCHMARK("map insert node_pool n=1000000") {
+        pool_map map;
+        return fill_map(map, n);
+    };
+
+    std_map std_filled;
+    pool_map pool_filled;
+    fill_map(std_filled, n);
+    fill_map(pool_filled, n);
+    BENCHMARK("map find std::allocator n=1000000") {
+        return std_filled.find(rand()) != std_filled.end();
+    };
+    BENCHMARK("map find node_pool n=1000000") {
+        return pool_filled.find(rand()) != pool_filled.end();
+    };
+}
+
+/* CHURN HEAVY */
+// the containers keep a steady size while nodes are freed & allocated again
+template <class Map>
+size_t churn_map (Map& map, int n)
+{
+    for (int i = 0; i < n; ++i) {
+        map.erase(map.begin());
+        map.insert(std::make_pair(rand(), i));
+    }
+    return map.size();
+}
+
+template <class List>
+size_t churn_list (List& list, int n)
+{
+    for (int i = 0; i < n; ++i) {
+        list.pop_front();
+        list.push_back(i);
+    }
+    return list.size();
+}
+
+TEST_CASE("node_pool vs std::allocator churn heavy", "[!benchmark][node_pool]")
+{
+    static const int n = 100000;
+
+    std_map std_m;
+    pool_map pool_m;
+    fill_map(std_m, n);
+    fill_map(pool_m, n);
+    BENCHMARK("map churn std::allocator n=100000") {
+        return churn_map(std_m, n);
+    };
+    BENCHMARK("map churn node_pool n=100000") {
+        return churn_map(pool_m, n);
+    };
+
+    std_list std_l (n, 0);
+    pool_list pool_l (n, 0);
+    BENCHMARK("list churn std::allocator n=100000") {
+        return churn_list(std_l, n);
+    };
+    BENCHMARK("list churn node_pool n=100000") {
+        return churn_list(pool_l, n);
+    };
+}
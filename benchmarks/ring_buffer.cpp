@@ -0,0 +1,74 @@
+#include "../srcs/ring_buffer/ring_buffer.hpp"
+#include "../srcs/queue/queue.hpp"
+#include "../tests/catch.hpp"
+
+#include <deque>
+#include <queue>
+#include <string>
+
+/* BOUNDED FIFO */
+// a send window which never holds more than a few thousand elements
+template <class Queue>
+static void bench_window (const std::string& name, Queue& q)
+{
+    static const int n = 10000000;
+    static const size_t window = 4096;
+
+    BENCHMARK(name + " push & pop n=10000000") {
+        long sum = 0;
+        for (int i = 0; i < n; ++i) {
+            q.push(i);
+            if (q.size() == window) {
+                sum += q.front();
+                q.pop();
+            }
+        }
+        while (!q.empty())
+            q.pop();
+        return sum;
+    };
+}
+
+TEST_CASE("ring_buffer bounded fifo", "[!benchmark][ring_buffer]")
+{
+    ft::ring_buffer<int> buffer;
+    buffer.reserve(4096);
+    ft::queue<int, ft::ring_buffer<int> > ring_queue (buffer);
+    ft::queue<int> deque_queue;
+    std::queue<int> std_queue;
+
+    bench_window("ft::queue<ft::ring_buffer>", ring_queue);
+    bench_window("ft::queue<ft::deque>", deque_queue);
+    bench_window("std::queue<std::deque>", std_queue);
+}
+
+/* HISTORY */
+// keeps the last 1024 samples, then averages them
+TEST_CASE("ring_buffer overwrite history", "[!benchmark][ring_buffer]")
+{
+    static const int n = 10000000;
+
+    BENCHMARK("ft::ring_buffer overwrite n=10000000") {
+        ft::ring_buffer<double> history;
+        history.reserve(1024);
+        history.set_overwrite(true);
+        for (int i = 0; i < n; ++i)
+            history.push_back(i);
+        double sum = 0;
+        for (size_t i = 0; i < history.size(); ++i)
+            sum += history[i];
+        return sum;
+    };
+    BENCHMARK("std::deque push_back & pop_front n=10000000") {
+        std::deque<double> history;
+        for (int i = 0; i < n; ++i) {
+            if (history.size() == 1024)
+                history.pop_front();
+            history.push_back(i);
+        }
+        double sum = 0;
+        for (size_t i = 0; i < history.size(); ++i)
+            sum += history[i];
+        return sum;
+    };
+}
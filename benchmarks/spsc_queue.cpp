@@ -0,0 +1,164 @@
+#include "../srcs/spsc_queue/spsc_queue.hpp"
+#include "../srcs/queue/queue.hpp"
+#include "../tests/catch.hpp"
+
+#include <mutex>
+#include <string>
+#include <thread>
+
+// the mutex-wrapped ft::queue the spsc_queue replaces between two threads.
+// a blocked side yields its time slice, the threads may share a single core
+template <class T>
+class locked_queue
+{
+    public:
+        bool try_push (const T& val)
+        {
+            std::lock_guard<std::mutex> lock (_mutex);
+            _queue.push(val);
+            return true;
+        }
+
+        bool try_pop (T& val)
+        {
+            std::lock_guard<std::mutex> lock (_mutex);
+            if (_queue.empty())
+                return false;
+            val = _queue.front();
+            _queue.pop();
+            return true;
+        }
+
+    private:
+        std::mutex _mutex;
+        ft::queue<T> _queue;
+};
+
+/* THROUGHPUT */
+// a producer thread streams n messages to the consumer on the calling thread
+template <class Queue>
+static long stream (Queue& q, int n)
+{
+    std::thread producer ([&q, n]() {
+        for (int i = 0; i < n; ++i) {
+            while (!q.try_push(i))
+                std::this_thread::yield();
+        }
+    });
+    long sum = 0;
+    for (int received = 0; received < n; ) {
+        int val;
+        if (q.try_pop(val)) {
+            sum += val;
+            ++received;
+        }
+        else
+            std::this_thread::yield();
+    }
+    producer.join();
+    return sum;
+}
+
+// both sides publish & release their messages by batches
+static long stream_batches (ft::spsc_queue<int>& q, int n)
+{
+    static const int batch_size = 64;
+
+    std::thread producer ([&q, n]() {
+        int batch[batch_size];
+        for (int sent = 0; sent < n; ) {
+            int count = 0;
+            for (; count < batch_size && sent + count < n; ++count)
+                batch[count] = sent + count;
+            for (int done = 0; done < count; ) {
+                int pushed = q.try_push_n(batch + done, count - done);
+                if (!pushed)
+                    std::this_thread::yield();
+                done += pushed;
+            }
+            sent += count;
+        }
+    });
+    long sum = 0;
+    int batch[batch_size];
+    for (int received = 0; received < n; ) {
+        int count = q.try_pop_n(batch, batch_size);
+        if (!count)
+            std::this_thread::yield();
+        for (int i = 0; i < count; ++i)
+            sum += batch[i];
+        received += count;
+    }
+    producer.join();
+    return sum;
+}
+
+TEST_CASE("spsc_queue two thread throughput", "[!benchmark][spsc_queue]")
+{
+    static const int n = 2000000;
+
+    BENCHMARK("ft::spsc_queue n=2000000") {
+        ft::spsc_queue<int> q;
+        return stream(q, n);
+    };
+
+    BENCHMARK("ft::spsc_queue max_size=4096 n=2000000") {
+        ft::spsc_queue<int> q (4096);
+        return stream(q, n);
+    };
+
+    BENCHMARK("ft::spsc_queue batches of 64 n=2000000") {
+        ft::spsc_queue<int> q;
+        return stream_batches(q, n);
+    };
+
+    BENCHMARK("mutex + ft::queue n=2000000") {
+        locked_queue<int> q;
+        return stream(q, n);
+    };
+}
+
+/* LATENCY */
+// a message bounces between two threads through a request & a reply queue,
+// each round trip pays for the hand-off latency twice
+template <class Queue>
+static long ping_pong (Queue& requests, Queue& replies, int rounds)
+{
+    std::thread echo ([&requests, &replies, rounds]() {
+        for (int i = 0; i < rounds; ++i) {
+            int val;
+            while (!requests.try_pop(val))
+                std::this_thread::yield();
+            while (!replies.try_push(val + 1))
+                std::this_thread::yield();
+        }
+    });
+    long sum = 0;
+    for (int i = 0; i < rounds; ++i) {
+        int val;
+        while (!requests.try_push(i))
+            std::this_thread::yield();
+        while (!replies.try_pop(val))
+            std::this_thread::yield();
+        sum += val;
+    }
+    echo.join();
+    return sum;
+}
+
+TEST_CASE("spsc_queue two thread round trip latency", "[!benchmark][spsc_queue]")
+{
+    static const int rounds = 100000;
+
+    BENCHMARK("ft::spsc_queue round trips n=100000") {
+        ft::spsc_queue<int> requests;
+        ft::spsc_queue<int> replies;
+        return ping_pong(requests, replies, rounds);
+    };
+
+    BENCHMARK("mutex + ft::queue round trips n=100000") {
+        locked_queue<int> requests;
+        locked_queue<int> replies;
+        return ping_pong(requests, replies, rounds);
+    };
+}
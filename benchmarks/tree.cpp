@@ -0,0 +1,124 @@
+#include "../srcs/map/map.hpp"
+#include "../srcs/multimap/multimap.hpp"
+#include "../tests/catch.hpp"
+
+#include <cstdlib> // rand
+#include <map>
+#include <vector>
+#include <algorithm> // std::shuffle
+#include <random> // std::mt19937
+
+/* BOUNDS */
+// the linear walk is what lower_bound used to do, the descent should stay
+// roughly flat while the walk grows with the size of the map
+TEST_CASE("map lower_bound descent vs linear walk", "[!benchmark][map]")
+{
+    static const int sizes[] = { 1000, 10000, 100000, 1000000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        int n = sizes[s];
+        ft::map<int, int> map;
+        for (int i = 0; i < n; ++i)
+            map.insert(map.end(), std::make_pair(i * 2, i));
+
+        BENCHMARK("lower_bound n=" + std::to_string(n)) {
+            return map.lower_bound(rand() % (n * 2));
+        };
+        if (n <= 100000) {
+            BENCHMARK("linear walk n=" + std::to_string(n)) {
+                int k = rand() % (n * 2);
+                ft::map<int, int>::iterator it = map.begin();
+                while (it != map.end() && it->first < k)
+                    ++it;
+                return it;
+            };
+        }
+    }
+}
+
+TEST_CASE("multimap count", "[!benchmark][multimap]")
+{
+    static const int sizes[] = { 1000, 100000, 1000000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        int n = sizes[s];
+        ft::multimap<int, int> mmap;
+        for (int i = 0; i < n; ++i)
+            mmap.insert(std::make_pair(rand() % 1000, i));
+
+        BENCHMARK("equal_range n=" + std::to_string(n)) {
+            return mmap.equal_range(rand() % 1000);
+        };
+        BENCHMARK("count n=" + std::to_string(n)) {
+            return mmap.count(rand() % 1000);
+        };
+    }
+}
+
+/* BULK CONSTRUCTION */
+TEST_CASE("map range construction", "[!benchmark][map]")
+{
+    static const int n = 1000000;
+    std::vector<std::pair<int, int> > sorted;
+    for (int i = 0; i < n; ++i)
+        sorted.push_back(std::make_pair(i, i));
+    std::vector<std::pair<int, int> > shuffled (sorted);
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+
+    BENCHMARK("sorted input n=1000000") {
+        return ft::map<int, int>(sorted.begin(), sorted.end()).size();
+    };
+    BENCHMARK("from_sorted n=1000000") {
+        return ft::map<int, int>::from_sorted(sorted.begin(), sorted.end()).size();
+    };
+    BENCHMARK("shuffled input n=1000000") {
+        return ft::map<int, int>(shuffled.begin(), shuffled.end()).size();
+    };
+}
+
+/* COPY */
+TEST_CASE("map copy", "[!benchmark][map]")
+{
+    static const int n = 1000000;
+    ft::map<int, int> src;
+    for (int i = 0; i < n; ++i)
+        src.insert(std::make_pair(rand(), i));
+    ft::map<int, int> dst (src);
+
+    BENCHMARK("copy constructor n=1000000") {
+        return ft::map<int, int>(src).size();
+    };
+    BENCHMARK("assignment reusing nodes n=1000000") {
+        dst = src;
+        return dst.size();
+    };
+    BENCHMARK("insert one by one n=1000000") {
+        ft::map<int, int> map;
+        for (ft::map<int, int>::const_iterator it = src.begin(); it != src.end(); ++it)
+            map.insert(*it);
+        return map.size();
+    };
+}
+
+// the header is embedded in the map, an empty map allocates nothing
+TEST_CASE("many small maps", "[!benchmark][map]")
+{
+    static const int n = 100000;
+
+    BENCHMARK("ft::map 100000 maps of 3 elements") {
+        std::vector<ft::map<int, int> > maps (n);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < 3; ++j)
+                maps[i].insert(std::make_pair(j, i));
+        }
+        return maps.size();
+    };
+    BENCHMARK("std::map 100000 maps of 3 elements") {
+        std::vector<std::map<int, int> > maps (n);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < 3; ++j)
+                maps[i].insert(std::make_pair(j, i));
+        }
+        return maps.size();
+    };
+}
@@ -0,0 +1,91 @@
+#include "../srcs/unrolled_list/unrolled_list.hpp"
+#include "../srcs/list/list.hpp"
+#include "../tests/catch.hpp"
+
+#include <algorithm> // std::shuffle
+#include <random> // std::mt19937
+#include <string>
+#include <vector>
+
+static std::vector<int> shuffled_ints (int n)
+{
+    std::vector<int> v (n);
+    for (int i = 0; i < n; ++i)
+        v[i] = i;
+    std::shuffle(v.begin(), v.end(), std::mt19937(42));
+    return v;
+}
+
+/* SEQUENTIAL SCAN */
+// a list filled by push_back gets its nodes in allocation order, once
+// sorted the nodes of ft::list are scattered over the heap
+template <class List>
+static void bench_scan (const std::string& name, const std::vector<int>& input)
+{
+    List cnt (input.begin(), input.end());
+
+    BENCHMARK(name + " scan after push_back n=1000000") {
+        long sum = 0;
+        for (typename List::const_iterator it = cnt.begin(); it != cnt.end(); ++it)
+            sum += *it;
+        return sum;
+    };
+    cnt.sort();
+    BENCHMARK(name + " scan after sort n=1000000") {
+        long sum = 0;
+        for (typename List::const_iterator it = cnt.begin(); it != cnt.end(); ++it)
+            sum += *it;
+        return sum;
+    };
+}
+
+TEST_CASE("unrolled_list scan", "[!benchmark][unrolled_list]")
+{
+    std::vector<int> input = shuffled_ints(1000000);
+
+    bench_scan< ft::list<int> >("ft::list", input);
+    bench_scan< ft::unrolled_list<int> >("ft::unrolled_list", input);
+}
+
+/* MIDDLE INSERTION */
+// every insertion walks from the front to the middle of the list
+template <class List>
+static void bench_middle_insert (const std::string& name)
+{
+    BENCHMARK(name + " insert in the middle n=20000") {
+        List cnt;
+        for (int i = 0; i < 20000; ++i) {
+            typename List::iterator mid = cnt.begin();
+            std::advance(mid, cnt.size() / 2);
+            cnt.insert(mid, i);
+        }
+        return cnt.size();
+    };
+}
+
+TEST_CASE("unrolled_list middle insertion", "[!benchmark][unrolled_list]")
+{
+    bench_middle_insert< ft::list<int> >("ft::list");
+    bench_middle_insert< ft::unrolled_list<int> >("ft::unrolled_list");
+}
+
+/* SORT */
+template <class List>
+static void bench_sort (const std::string& name, const std::vector<int>& input)
+{
+    List cnt;
+
+    BENCHMARK(name + " assign & sort n=1000000") {
+        cnt.assign(input.begin(), input.end());
+        cnt.sort();
+        return cnt.front();
+    };
+}
+
+TEST_CASE("unrolled_list sort", "[!benchmark][unrolled_list]")
+{
+    std::vector<int> input = shuffled_ints(1000000);
+
+    bench_sort< ft::list<int> >("ft::list", input);
+    bench_sort< ft::unrolled_list<int> >("ft::unrolled_list", input);
+}
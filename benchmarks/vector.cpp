@@ -0,0 +1,191 @@
+#include "../srcs/vector/vector.hpp"
+#include "../srcs/vector/small_vector.hpp"
+#include "../tests/catch.hpp"
+
+#include <string>
+#include <iostream>
+#include <memory> // std::allocator
+
+/* INSERT & ERASE */
+// every iteration inserts an element & erases it again so the
+// vector keeps its size across the samples
+template <class T>
+void bench_insert_erase (const std::string& type, int n, const T& val)
+{
+    ft::vector<T> vec (n, val);
+    size_t positions[] = { 0, static_cast<size_t>(n / 2), static_cast<size_t>(n) };
+    const char * names[] = { "front", "middle", "back" };
+
+    for (int p = 0; p < 3; ++p) {
+        size_t pos = positions[p];
+        BENCHMARK(type + " insert/erase " + names[p] + " n=" + std::to_string(n)) {
+            vec.insert(vec.begin() + pos, val);
+            vec.erase(vec.begin() + pos);
+            return vec.size();
+        };
+    }
+}
+
+TEST_CASE("vector insert & erase", "[!benchmark][vector]")
+{
+    static const int sizes[] = { 1000, 100000, 1000000, 10000000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s)
+        bench_insert_erase<int>("int", sizes[s], 42);
+    for (size_t s = 0; s < 2; ++s)
+        bench_insert_erase<std::string>("string", sizes[s], "forty two");
+}
+
+TEST_CASE("vector range insert & erase", "[!benchmark][vector]")
+{
+    static const int n = 1000000;
+    ft::vector<int> chunk (1000, 42);
+    ft::vector<int> vec (n, 42);
+
+    BENCHMARK("int insert/erase 1000 elements middle n=1000000") {
+        vec.insert(vec.begin() + n / 2, chunk.begin(), chunk.end());
+        vec.erase(vec.begin() + n / 2, vec.begin() + n / 2 + chunk.size());
+        return vec.size();
+    };
+}
+
+/* RELOCATION */
+struct pod
+{
+    int a;
+    int b;
+    double c;
+};
+
+TEST_CASE("vector growth of trivially relocatable elements", "[!benchmark][vector]")
+{
+    static const int n = 20000000;
+    pod val = { 1, 2, 3.0 };
+
+    BENCHMARK("pod push_back n=20000000") {
+        ft::vector<pod> vec;
+        for (int i = 0; i < n; ++i)
+            vec.push_back(val);
+        return vec.size();
+    };
+}
+
+/* GROWTH POLICIES */
+// records the bytes held by every counting_allocator, the peak is what the
+// buffers of a vector cost at most while it grows, old & new buffer included
+struct allocation_stats
+{
+    static size_t current;
+    static size_t peak;
+    static size_t count;
+};
+
+size_t allocation_stats::current = 0;
+size_t allocation_stats::peak = 0;
+size_t allocation_stats::count = 0;
+
+template <class T>
+struct counting_allocator : public std::allocator<T>
+{
+    template <class U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator (void) {}
+    template <class U>
+    counting_allocator (const counting_allocator<U>&) {}
+
+    T* allocate (size_t n, const void* = 0)
+    {
+        ++allocation_stats::count;
+        allocation_stats::current += n * sizeof(T);
+        allocation_stats::peak = std::max(allocation_stats::peak, allocation_stats::current);
+        return std::allocator<T>::allocate(n);
+    }
+
+    void deallocate (T* p, size_t n)
+    {
+        allocation_stats::current -= n * sizeof(T);
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+template <class Policy>
+void bench_growth (const std::string& name, int n)
+{
+    typedef ft::vector<pod, counting_allocator<pod>, Policy> vector_type;
+    pod val = { 1, 2, 3.0 };
+
+    allocation_stats::peak = allocation_stats::current;
+    {
+        vector_type vec;
+        for (int i = 0; i < n; ++i)
+            vec.push_back(val);
+        std::cout << name << " n=" << n << ": capacity " << vec.capacity()
+                  << ", peak " << allocation_stats::peak / 1024 << " KiB for "
+                  << n * sizeof(pod) / 1024 << " KiB of elements" << std::endl;
+    }
+    BENCHMARK(name + " push_back n=" + std::to_string(n)) {
+        vector_type vec;
+        for (int i = 0; i < n; ++i)
+            vec.push_back(val);
+        return vec.size();
+    };
+}
+
+TEST_CASE("vector growth policies", "[!benchmark][vector]")
+{
+    static const int sizes[] = { 1000, 100000, 10000000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        bench_growth<ft::default_growth>("default_growth", sizes[s]);
+        bench_growth<ft::doubling_growth>("doubling_growth", sizes[s]);
+        bench_growth<ft::golden_growth>("golden_growth", sizes[s]);
+        bench_growth<ft::page_growth<> >("page_growth", sizes[s]);
+        bench_growth<ft::huge_page_growth>("huge_page_growth", sizes[s]);
+    }
+}
+
+/* SMALL VECTOR */
+// short lived vectors holding a handful of elements, the allocations are
+// counted once before the timings
+template <class Vector>
+size_t fill_short_lived (int vectors, int elements)
+{
+    size_t total = 0;
+    for (int i = 0; i < vectors; ++i) {
+        Vector vec;
+        for (int j = 0; j < elements; ++j)
+            vec.push_back(j);
+        total += vec.size();
+    }
+    return total;
+}
+
+TEST_CASE("small_vector vs vector", "[!benchmark][vector][small_vector]")
+{
+    typedef ft::vector<int, counting_allocator<int> > vector_type;
+    typedef ft::small_vector<int, 8, counting_allocator<int> > small_vector_type;
+    static const int vectors = 100000;
+    static const int sizes[] = { 2, 8, 16 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        int n = sizes[s];
+        allocation_stats::count = 0;
+        fill_short_lived<vector_type>(vectors, n);
+        std::cout << vectors << " vectors of " << n << " elements: vector "
+                  << allocation_stats::count << " allocations, ";
+        allocation_stats::count = 0;
+        fill_short_lived<small_vector_type>(vectors, n);
+        std::cout << "small_vector<8> " << allocation_stats::count << " allocations" << std::endl;
+
+        BENCHMARK("vector 100000 vectors of " + std::to_string(n)) {
+            return fill_short_lived<vector_type>(vectors, n);
+        };
+        BENCHMARK("small_vector<8> 100000 vectors of " + std::to_string(n)) {
+            return fill_short_lived<small_vector_type>(vectors, n);
+        };
+    }
+}
@@ -0,0 +1,400 @@
+#pragma once
+
+#include "../vector/vector.hpp"
+#include "../utils/utils.hpp"
+
+// the queue is built on C++11 atomics & threads, it is not available without them
+#ifdef FT_HAS_CXX11
+
+#include <atomic> // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <cstddef> // size_t, std::ptrdiff_t
+#include <memory> // std::allocator
+#include <mutex> // std::mutex, std::unique_lock
+#include <new> // placement new
+#include <utility> // std::forward, std::move
+
+namespace ft {
+
+/* CONCURRENT QUEUE */
+// bounded queue shared by any number of producer & consumer threads. the
+// elements live in a ring of cells whose capacity is a power of two, each
+// cell carrying a sequence number which tells the threads whose turn it is:
+//   sequence == pos          the cell is free for the push claiming pos
+//   sequence == pos + 1      the cell holds the element of the pop claiming pos
+//   sequence == pos + cap    the element was popped, the cell is free for the
+//                            push claiming pos one round later
+// a thread claims a position with a compare & swap on the push or pop
+// cursor, then only touches its own cell, so producers & consumers never
+// contend on the same cache line unless the queue is empty or full. a
+// claimed cell is always handed on: a push whose element throws while it
+// is built publishes its cell empty & the pops skip it, a pop whose
+// element throws while it is moved out destroys it & frees the cell
+//
+// the try_ functions never block, push & pop park the calling thread on a
+// condition variable while the queue stays full or empty. the threads on
+// the lock-free path only take the mutex to wake parked threads
+template < class T, class Alloc = std::allocator<T> >
+class concurrent_queue
+{
+    public:
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef size_t size_type;
+
+    private:
+        static const size_t cache_line = 64;
+
+        struct cell
+        {
+            std::atomic<size_type> sequence;
+            // whether the push published an element, written before the
+            // sequence is
+            bool filled;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T* value (void) { return reinterpret_cast<T*>(storage); }
+        };
+
+        typedef typename allocator_type::template rebind<cell>::other cell_allocator_type;
+
+    public:
+        /* CONSTRUCTORS */
+        // the capacity is rounded up to a power of two, at least 2
+        explicit concurrent_queue (size_type capacity, const allocator_type& alloc = allocator_type())
+            : _alloc(alloc), _cell_alloc(alloc), _capacity(2), _waiting_pushers(0), _waiting_poppers(0)
+        {
+            while (_capacity < capacity)
+                _capacity *= 2;
+            _cells = _cell_alloc.allocate(_capacity);
+            for (size_type i = 0; i < _capacity; ++i) {
+                ::new (static_cast<void*>(&_cells[i].sequence)) std::atomic<size_type>(i);
+                _cells[i].filled = false;
+            }
+            _push_pos = 0;
+            _pop_pos = 0;
+        }
+
+        concurrent_queue (const concurrent_queue&) = delete;
+        concurrent_queue& operator= (const concurrent_queue&) = delete;
+
+        /* DESTRUCTOR */
+        // no thread may use the queue anymore
+        ~concurrent_queue()
+        {
+            size_type pos = _pop_pos.load(std::memory_order_relaxed);
+            size_type last = _push_pos.load(std::memory_order_relaxed);
+            for (; pos != last; ++pos) {
+                if (cell_at(pos).filled)
+                    _alloc.destroy(cell_at(pos).value());
+            }
+            _cell_alloc.deallocate(_cells, _capacity);
+        }
+
+        /* CAPACITY */
+        // a snapshot, it may be outdated as soon as it is returned
+        size_type size (void) const
+        {
+            size_type pop = _pop_pos.load(std::memory_order_acquire);
+            size_type push = _push_pos.load(std::memory_order_acquire);
+            return push > pop ? ft::min(push - pop, _capacity) : 0;
+        }
+
+        bool empty (void) const { return size() == 0; }
+        size_type capacity (void) const { return _capacity; }
+
+        /* NON-BLOCKING */
+        // fails if the queue is full
+        bool try_push (const value_type& val)
+        {
+            return try_emplace(val);
+        }
+
+        bool try_push (value_type&& val)
+        {
+            return try_emplace(std::move(val));
+        }
+
+        // the arguments are only used if a cell was claimed
+        template <class... Args>
+        bool try_emplace (Args&&... args)
+        {
+            pending_wake published = { *this, _waiting_poppers, _not_empty, false };
+            return claim_push(published.pending, std::forward<Args>(args)...);
+        }
+
+        // fails if the queue is empty, the element is moved into val
+        bool try_pop (value_type& val)
+        {
+            pending_wake freed = { *this, _waiting_pushers, _not_full, false };
+            return claim_pop(val, freed.pending);
+        }
+
+        // pops up to n elements at the end of out, returns their count. the
+        // run of ready cells after the pop cursor is claimed at once, the
+        // empty ones among them are skipped
+        size_type pop_bulk (ft::vector<value_type>& out, size_type n)
+        {
+            if (n == 0)
+                return 0;
+            // out cannot reallocate once the cells are claimed
+            out.reserve(out.size() + ft::min(n, _capacity));
+            size_type pos = _pop_pos.load(std::memory_order_relaxed);
+            size_type count;
+            for (;;) {
+                count = 0;
+                while (count < n && count < _capacity
+                    && cell_at(pos + count).sequence.load(std::memory_order_acquire) == pos + count + 1)
+                    ++count;
+                if (count == 0) {
+                    std::ptrdiff_t diff = cell_at(pos).sequence.load(std::memory_order_acquire) - (pos + 1);
+                    if (diff < 0)
+                        return 0;
+                    pos = _pop_pos.load(std::memory_order_relaxed);
+                }
+                else if (_pop_pos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+                    break ;
+            }
+            bulk_release claimed (*this, pos, count);
+            size_type popped = 0;
+            while (claimed.done < count) {
+                cell& c = cell_at(pos + claimed.done);
+                if (c.filled) {
+                    out.push_back(std::move(*c.value()));
+                    ++popped;
+                }
+                claimed.release_next();
+            }
+            return popped;
+        }
+
+        /* BLOCKING */
+        // waits for a free cell
+        void push (const value_type& val)
+        {
+            emplace(val);
+        }
+
+        void push (value_type&& val)
+        {
+            emplace(std::move(val));
+        }
+
+        // the poppers are woken once the lock is released
+        template <class... Args>
+        void emplace (Args&&... args)
+        {
+            pending_wake published = { *this, _waiting_poppers, _not_empty, false };
+            if (claim_push(published.pending, std::forward<Args>(args)...))
+                return ;
+            std::unique_lock<std::mutex> lock (_mutex);
+            park(_waiting_pushers);
+            parked_thread parked = { _waiting_pushers };
+            while (!claim_push(published.pending, std::forward<Args>(args)...))
+                _not_full.wait(lock);
+        }
+
+        // waits for an element, which is moved into val. the pushers are
+        // woken once the lock is released
+        void pop (value_type& val)
+        {
+            pending_wake freed = { *this, _waiting_pushers, _not_full, false };
+            if (claim_pop(val, freed.pending))
+                return ;
+            std::unique_lock<std::mutex> lock (_mutex);
+            park(_waiting_poppers);
+            parked_thread parked = { _waiting_poppers };
+            while (!claim_pop(val, freed.pending)) {
+                // the empty cells skipped are free, the pushers waiting
+                // for them can't wait for this pop to end
+                if (freed.pending)
+                    _not_full.notify_all();
+                freed.pending = false;
+                _not_empty.wait(lock);
+            }
+        }
+
+    private:
+        allocator_type _alloc;
+        cell_allocator_type _cell_alloc;
+        cell * _cells;
+        size_type _capacity;
+
+        // parking of the blocked threads
+        std::mutex _mutex;
+        std::condition_variable _not_full;
+        std::condition_variable _not_empty;
+        std::atomic<int> _waiting_pushers;
+        std::atomic<int> _waiting_poppers;
+
+        // the cursors are claimed by different threads, they get a cache
+        // line each, the alignment also pads the end of the queue
+        alignas(cache_line) std::atomic<size_type> _push_pos;
+        alignas(cache_line) std::atomic<size_type> _pop_pos;
+
+        cell& cell_at (size_type pos) { return _cells[pos & (_capacity - 1)]; }
+
+        // hands the cells claimed by pop_bulk back to the pushers one by
+        // one, the ones left when an element throws while it is moved out
+        // are released with their elements destroyed, or the ring would
+        // stay blocked on them
+        struct bulk_release
+        {
+            concurrent_queue& queue;
+            size_type pos;
+            size_type count;
+            size_type done;
+
+            bulk_release (concurrent_queue& q, size_type first, size_type n)
+                : queue(q), pos(first), count(n), done(0)
+            {
+            }
+
+            ~bulk_release()
+            {
+                while (done < count)
+                    release_next();
+                queue.wake(queue._waiting_pushers, queue._not_full, count > 1);
+            }
+
+            void release_next (void)
+            {
+                cell * c = &queue.cell_at(pos + done);
+                if (c->filled)
+                    queue._alloc.destroy(c->value());
+                c->sequence.store(pos + done + queue._capacity, std::memory_order_release);
+                ++done;
+            }
+        };
+
+        // the cell a push claimed, it is published once the element is
+        // built or its construction threw, empty then
+        struct cell_publish
+        {
+            cell * c;
+            size_type pos;
+
+            ~cell_publish() { c->sequence.store(pos + 1, std::memory_order_release); }
+        };
+
+        // the cell a pop claimed, its element is destroyed & the cell freed
+        // once it was moved out or moving it threw
+        struct cell_release
+        {
+            concurrent_queue& queue;
+            cell * c;
+            size_type pos;
+
+            ~cell_release()
+            {
+                queue._alloc.destroy(c->value());
+                c->sequence.store(pos + queue._capacity, std::memory_order_release);
+            }
+        };
+
+        // wakes the threads parked on cond on the way out of a push or a
+        // pop which claimed a cell, even if its element threw
+        struct pending_wake
+        {
+            concurrent_queue& queue;
+            std::atomic<int>& waiting;
+            std::condition_variable& cond;
+            bool pending;
+
+            ~pending_wake()
+            {
+                if (pending)
+                    queue.wake(waiting, cond);
+            }
+        };
+
+        // a thread parked by park, it leaves even if its claim throws
+        struct parked_thread
+        {
+            std::atomic<int>& waiting;
+
+            ~parked_thread() { waiting.fetch_sub(1); }
+        };
+
+        // a thread claims a position by moving the cursor past it, the
+        // cell is then its own until it publishes the next sequence.
+        // claimed is set once it did
+        template <class... Args>
+        bool claim_push (bool& claimed, Args&&... args)
+        {
+            size_type pos = _push_pos.load(std::memory_order_relaxed);
+            cell * c;
+            for (;;) {
+                c = &cell_at(pos);
+                std::ptrdiff_t diff = c->sequence.load(std::memory_order_acquire) - pos;
+                if (diff == 0) {
+                    if (_push_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break ;
+                }
+                else if (diff < 0)
+                    return false;
+                else
+                    pos = _push_pos.load(std::memory_order_relaxed);
+            }
+            claimed = true;
+            cell_publish publish = { c, pos };
+            c->filled = false;
+            _alloc.construct(c->value(), std::forward<Args>(args)...);
+            c->filled = true;
+            return true;
+        }
+
+        // the empty cells met on the way are freed, freed is set once a
+        // cell was
+        bool claim_pop (value_type& val, bool& freed)
+        {
+            size_type pos = _pop_pos.load(std::memory_order_relaxed);
+            cell * c;
+            for (;;) {
+                c = &cell_at(pos);
+                std::ptrdiff_t diff = c->sequence.load(std::memory_order_acquire) - (pos + 1);
+                if (diff == 0) {
+                    if (_pop_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        freed = true;
+                        if (c->filled)
+                            break ;
+                        c->sequence.store(pos + _capacity, std::memory_order_release);
+                        pos = _pop_pos.load(std::memory_order_relaxed);
+                    }
+                }
+                else if (diff < 0)
+                    return false;
+                else
+                    pos = _pop_pos.load(std::memory_order_relaxed);
+            }
+            cell_release release = { *this, c, pos };
+            val = std::move(*c->value());
+            return true;
+        }
+
+        // a parked thread announces itself before its last try, a waking
+        // thread checks for parked threads after publishing its cell. the
+        // fences order both sides, one of them sees the other
+        void park (std::atomic<int>& waiting)
+        {
+            waiting.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        void wake (std::atomic<int>& waiting, std::condition_variable& cond, bool all = false)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed) == 0)
+                return ;
+            std::lock_guard<std::mutex> lock (_mutex);
+            if (all)
+                cond.notify_all();
+            else
+                cond.notify_one();
+        }
+
+}; // CLASS CONCURRENT_QUEUE
+
+} // NAMESPACE FT
+
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef> // size_t
+
+namespace ft {
+
+/* CHUNK POLICIES */
+// a chunk policy gives the number of elements stored in each chunk of a
+// deque, through its elements<T>::value member. a chunk holds 2 elements
+// at least
+
+// sizes the chunks in bytes, elements larger than half a chunk get
+// chunks of 2 elements
+template <size_t Bytes = 4096>
+struct chunk_bytes
+{
+    template <class T>
+    struct elements
+    {
+        static const size_t value = Bytes / sizeof(T) > 2 ? Bytes / sizeof(T) : 2;
+    };
+};
+
+// pins the number of elements per chunk whatever their size
+template <size_t N>
+struct chunk_elements
+{
+    template <class T>
+    struct elements
+    {
+        static const size_t value = N > 2 ? N : 2;
+    };
+};
+
+} // NAMESPACE FT
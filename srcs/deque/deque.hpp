@@ -1,11 +1,13 @@
 #pragma once
 
 #include "deque_iterator.hpp"
+#include "chunk_policy.hpp"
 #include "../utils/utils.hpp"
-
-#include "../vector/vector.hpp"
+#include "../utils/algorithm.hpp"
 
 #include <cstddef> // std::ptrdiff_t, size_t, NULL
+#include <cstring> // std::memcpy, std::memmove
+#include <iterator> // std::distance
 
 #include <memory> // std::allocator
 #include <stdexcept> // std::out_of_range
@@ -13,14 +15,15 @@
 
 namespace ft {
 
-template < class T, class Alloc = std::allocator<T> >
+template < class T, class Alloc = std::allocator<T>, class ChunkPolicy = ft::chunk_bytes<> >
 class deque
 {
-    static const size_t chunk_size = 32;
-
     public:
+        static const size_t chunk_size = ChunkPolicy::template elements<T>::value;
+
         typedef T value_type;
         typedef Alloc allocator_type;
+        typedef ChunkPolicy chunk_policy;
         typedef typename allocator_type::reference reference;
         typedef typename allocator_type::const_reference const_reference;
         typedef typename allocator_type::pointer pointer;
@@ -33,7 +36,6 @@ class deque
         typedef size_t size_type;
 
     private:
-        typedef deque<value_type, allocator_type> self_type;
         typedef typename allocator_type::template rebind<value_type*>::other ptr_allocator_type;
         typedef value_type** map_pointer;
 
@@ -42,14 +44,14 @@ class deque
         explicit deque (const allocator_type& alloc = allocator_type())
             : _alloc(alloc), _ptr_alloc(alloc)
         {
-            initialize_map();
+            initialize_empty();
         }
 
         explicit deque (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
             : _alloc(alloc), _ptr_alloc(alloc)
         {
-            initialize_map();
-            assign(n, val);
+            initialize_empty();
+            push_back_n(n, val);
         }
 
         template <class InputIterator>
@@ -57,81 +59,104 @@ class deque
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
             : _alloc(alloc), _ptr_alloc(alloc)
         {
-            initialize_map();
-            assign(first, last);
+            initialize_empty();
+            append(first, last);
         }
 
         deque (const deque& x)
             : _alloc(x._alloc), _ptr_alloc(x._ptr_alloc)
         {
-            initialize_map();
+            initialize_empty();
             *this = x;
         }
 
+#ifdef FT_HAS_CXX11
+        // x is left empty
+        deque (deque&& x)
+            : _alloc(x._alloc), _ptr_alloc(x._ptr_alloc)
+        {
+            initialize_empty();
+            swap(x);
+        }
+#endif
+
         /* DESTRUCTOR */
         ~deque()
         {
-            clear();
-            for (size_type i = 0; i < _map_size; ++i)
-                _alloc.deallocate(_map[i], chunk_size);
-            _ptr_alloc.deallocate(_map, _map_size);
+            destroy_range(begin(), end());
+            release_map();
         }
 
         /* OPERATORS */
         deque& operator= (const deque& x)
         {
-            if (this != &x) {
-                assign(x.begin(), x.end());
+            if (this == &x)
+                return *this;
+            // the elements already there are overwritten chunk by chunk
+            if (x._size <= _size) {
+                erase(ft::copy(x.begin(), x.end(), begin()), end());
+            } else {
+                const_iterator mid = x.begin() + _size;
+                ft::copy(x.begin(), mid, begin());
+                append(mid, x.end());
             }
             return *this;
         }
 
-        friend bool operator== (const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs)
+#ifdef FT_HAS_CXX11
+        deque& operator= (deque&& x)
         {
-            if (lhs._size != rhs._size)
-                return false;
-            for (size_type i = 0; i < lhs._size; ++i) {
-                if (lhs[i] != rhs[i])
-                    return false;
+            if (this != &x) {
+                clear();
+                swap(x);
             }
-            return true;
+            return *this;
         }
+#endif
 
-        friend bool operator< (const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs)
+        friend bool operator== (const deque& lhs, const deque& rhs)
         {
-            for (size_type i = 0; i < lhs._size && i < rhs._size; ++i) {
-                if (lhs[i] < rhs[i])
-                    return true;
-                if (lhs[i] > rhs[i])
-                    return false;
-            }
-            if (lhs._size >= rhs._size)
-                return false;
-            return true;
+            return lhs._size == rhs._size && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
         }
 
-        friend bool operator!= (const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) { return !(lhs == rhs); }
-        friend bool operator<= (const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) { return !(rhs < lhs); }
-        friend bool operator> (const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) { return rhs < lhs; }
-        friend bool operator>= (const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) { return !(lhs < rhs); }
+        friend bool operator< (const deque& lhs, const deque& rhs)
+        {
+            return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend bool operator!= (const deque& lhs, const deque& rhs) { return !(lhs == rhs); }
+        friend bool operator<= (const deque& lhs, const deque& rhs) { return !(rhs < lhs); }
+        friend bool operator> (const deque& lhs, const deque& rhs) { return rhs < lhs; }
+        friend bool operator>= (const deque& lhs, const deque& rhs) { return !(lhs < rhs); }
 
         /* ITERATORS */
-        iterator begin() { return _first + 1; }
+        iterator begin() { return _map ? _first + 1 : _last; }
         iterator end() { return _last; }
         const_iterator end() const { return _last; }
         reverse_iterator rend() { return reverse_iterator(_first.get_curr(), _first.get_map()); }
         const_reverse_iterator rend() const { return const_reverse_iterator(_first.get_curr(), _first.get_map()); }
-        reverse_iterator rbegin() { return reverse_iterator((_last - 1).get_curr(), (_last - 1).get_map()); }
+
+        reverse_iterator rbegin()
+        {
+            if (!_map)
+                return reverse_iterator();
+            iterator it = _last - 1;
+            return reverse_iterator(it.get_curr(), it.get_map());
+        }
 
         const_iterator begin() const
         {
             const_iterator it = _first;
+            if (!_map)
+                return it;
             return ++it;
         }
 
         const_reverse_iterator rbegin() const
         {
             const_iterator it = _last;
+            if (!_map)
+                return const_reverse_iterator();
             --it;
             return const_reverse_iterator(it.get_curr(), it.get_map());
         }
@@ -141,11 +166,36 @@ class deque
         size_type max_size() const { return _alloc.max_size(); }
         bool empty() const { return _size == 0; }
 
+        // releases the spare chunks & the unused slots of the map, an empty
+        // deque gives back all of its memory
+        void shrink_to_fit (void)
+        {
+            if (!_map)
+                return ;
+            if (_size == 0) {
+                release_map();
+                initialize_empty();
+                return ;
+            }
+            while (_spare_count)
+                _alloc.deallocate(_spare[--_spare_count], chunk_size);
+            map_pointer first_slot = _first.get_map();
+            size_type used = _last.get_map() - first_slot + 1;
+            if (used == _map_size)
+                return ;
+            map_pointer new_map = _ptr_alloc.allocate(used);
+            std::memcpy(new_map, first_slot, used * sizeof(*_map));
+            _ptr_alloc.deallocate(_map, _map_size);
+            _map = new_map;
+            _map_size = used;
+            _first.set_map(new_map);
+            _last.set_map(new_map + used - 1);
+        }
+
         void resize (size_type n, value_type val = value_type())
         {
             if (_size < n) {
-                while (_size < n)
-                    push_back(val);
+                push_back_n(n - _size, val);
             } else {
                 while (n < _size)
                     pop_back();
@@ -153,81 +203,117 @@ class deque
         }
 
         /* ELEMENT ACCESS */
-        reference front () { return _first[1]; }
-        const_reference front () const { return begin()[0]; }
-        reference back () { return _last[-1]; }
-        const_reference back () const { return end()[-1]; }
+        reference front () { return *element(0); }
+        const_reference front () const { return *element(0); }
+        reference back () { return *element(_size - 1); }
+        const_reference back () const { return *element(_size - 1); }
 
         reference at (size_type n)
         {
             if (n >= _size)
                 throw std::out_of_range("ft::deque");
-            return _first[n + 1];
+            return *element(n);
         }
 
         const_reference at (size_type n) const
         {
             if (n >= _size)
                 throw std::out_of_range("ft::deque");
-            return begin()[n];
+            return *element(n);
         }
 
-        reference operator[] (size_type n) { return _first[n + 1]; }
-        const_reference operator[] (size_type n) const { return begin()[n]; }
+        reference operator[] (size_type n) { return *element(n); }
+        const_reference operator[] (size_type n) const { return *element(n); }
 
         /* MODIFIERS */
         template <class InputIterator>
         void assign (InputIterator first, InputIterator last,
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
         {
-            clear();
-            for (; first != last; ++first)
-                push_back(*first);
+            iterator it = begin();
+            for (; first != last && it != end(); ++first, ++it)
+                *it = *first;
+            if (it != end())
+                erase(it, end());
+            append(first, last);
         }
 
         void assign(size_type n, const value_type& val)
         {
-            clear();
-            for (size_type i = 0; i < n; ++i)
-                push_back(val);
+            // val may refer to an element which is about to be erased
+            value_type copy (val);
+            if (n == 0) {
+                clear();
+            } else if (n <= _size) {
+                ft::fill(begin(), begin() + n, copy);
+                erase(begin() + n, end());
+            } else {
+                ft::fill(begin(), end(), copy);
+                push_back_n(n - _size, copy);
+            }
         }
 
         // PUSH N POP
         void push_front (const value_type& val)
         {
-            // if current first chunk will be full after push_front
-            // and there is no empty chunk preceding it
-            if (_first.is_first() && _first.get_map() == _map) {
-                pointer tmp = _first.get_curr();
-                realloc_map(true);
-                _alloc.construct(tmp, val);
-            } else {
-                _alloc.construct(_first.get_curr(), val);
-                --_first;
-            }
+            // _first moves to the preceding chunk once it is filled
+            if (!_map || _first.is_first())
+                reserve_slots(1, true);
+            _alloc.construct(_first.get_curr(), val);
+            --_first;
             ++_size;
         }
 
         void push_back (const value_type& val)
         {
-            // if current last chunk will be full after push_back
-            // and there is no empty chunk succeeding it
-            if (_last.is_last() && _last.get_map() == _map + _map_size - 1) {
-                pointer tmp = _last.get_curr();
-                realloc_map(false);
-                _alloc.construct(tmp, val);
-            } else {
-                _alloc.construct(_last.get_curr(), val);
-                ++_last;
-            }
+            // _last moves to the succeeding chunk once it is filled
+            if (!_map || _last.is_last())
+                reserve_slots(1, false);
+            _alloc.construct(_last.get_curr(), val);
+            ++_last;
+            ++_size;
+        }
+
+#ifdef FT_HAS_CXX11
+        void push_front (value_type&& val)
+        {
+            emplace_front(std::move(val));
+        }
+
+        void push_back (value_type&& val)
+        {
+            emplace_back(std::move(val));
+        }
+
+        template <class... Args>
+        void emplace_front (Args&&... args)
+        {
+            if (!_map || _first.is_first())
+                reserve_slots(1, true);
+            _alloc.construct(_first.get_curr(), std::forward<Args>(args)...);
+            --_first;
             ++_size;
         }
 
+        template <class... Args>
+        void emplace_back (Args&&... args)
+        {
+            if (!_map || _last.is_last())
+                reserve_slots(1, false);
+            _alloc.construct(_last.get_curr(), std::forward<Args>(args)...);
+            ++_last;
+            ++_size;
+        }
+#endif
+
+        // a chunk left by _first or _last is empty & goes back to the spares
         void pop_front (void)
         {
             ++_first;
             _alloc.destroy(_first.get_curr());
             --_size;
+            if (_first.is_first())
+                release_chunks(_first.get_map() - 1, _first.get_map());
         }
 
         void pop_back (void)
@@ -235,6 +321,44 @@ class deque
             --_last;
             _alloc.destroy(_last.get_curr());
             --_size;
+            if (_last.is_last())
+                release_chunks(_last.get_map() + 1, _last.get_map() + 2);
+        }
+
+        // APPEND N PREPEND
+        // the slots are reserved at once & the elements are built chunk by
+        // chunk, with a memcpy from contiguous ranges of trivially copyable
+        // elements. prepend keeps the order of the range
+        template <class InputIterator>
+        void append (InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+        {
+            append(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+        }
+
+        template <class InputIterator>
+        void prepend (InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+        {
+            prepend(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+        }
+
+        void push_back_n (size_type n, const value_type& val)
+        {
+            if (n == 0)
+                return ;
+            // val stays in place, the existing elements are not moved
+            reserve_slots(n, false);
+            iterator dst = _last;
+            for (size_type left = n; left > 0; ) {
+                size_type run = ft::min(left, size_type(chunk_end(dst)));
+                construct_fill(dst.get_curr(), run, val);
+                left -= run;
+                if (left > 0)
+                    dst += run;
+            }
+            _last += n;
+            _size += n;
         }
 
         // INSERT
@@ -245,26 +369,50 @@ class deque
             return begin() + i;
         }
 
+#ifdef FT_HAS_CXX11
+        iterator insert (iterator position, value_type&& val)
+        {
+            return emplace(position, std::move(val));
+        }
+
+        // the new element is built before the elements are shifted, as
+        // its arguments may refer to one of them
+        template <class... Args>
+        iterator emplace (iterator position, Args&&... args)
+        {
+            size_type i = position - begin();
+            if (i == 0) {
+                emplace_front(std::forward<Args>(args)...);
+            } else if (i == _size) {
+                emplace_back(std::forward<Args>(args)...);
+            } else {
+                value_type tmp (std::forward<Args>(args)...);
+                move_builder build = { tmp };
+                insert_gap(i, 1, build);
+            }
+            return begin() + i;
+        }
+#endif
+
         void insert (iterator position, size_type n, const value_type& val)
         {
-            ft::vector<value_type> tmp (position, end());
-            erase(position, end());
-            for (size_type i = 0; i < n; ++i)
-                push_back(val);
-            for (typename ft::vector<value_type>::iterator it = tmp.begin(); it != tmp.end(); ++it)
-                push_back(*it);
+            if (n == 0)
+                return ;
+            // val may refer to an element which is about to be shifted
+            value_type copy (val);
+            fill_builder build = { copy };
+            insert_gap(position - begin(), n, build);
         }
 
         template <class InputIterator>
         void insert (iterator position, InputIterator first, InputIterator last,
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
         {
-            ft::vector<value_type> tmp (position, end());
-            erase(position, end());
-            for (; first != last; ++first)
-                push_back(*first);
-            for (typename ft::vector<value_type>::iterator it = tmp.begin(); it != tmp.end(); ++it)
-                push_back(*it);
+            size_type n = std::distance(first, last);
+            if (n == 0)
+                return ;
+            range_builder<InputIterator> build = { first };
+            insert_gap(position - begin(), n, build);
         }
 
         // ERASE
@@ -275,29 +423,29 @@ class deque
 
         iterator erase (iterator first, iterator last)
         {
-            _size -= last - first;
-            iterator tmp = first;
+            difference_type n = last - first;
             difference_type offset = first - begin();
+            if (n == 0)
+                return first;
 
-            for (; tmp != last; ++tmp)
-                _alloc.destroy(tmp.get_curr());
-
-            if (last - end() < first - begin()) { // shift succeeding elements to the left
-                for (iterator it = last; it != end(); ++it, ++first) {
-                    _alloc.construct(first.get_curr(), *it);
-                    _alloc.destroy(it.get_curr());
-                }
-                _last = _first + _size + 1;
-                _first = _last - _size - 1;
+            // elements which may throw while moved are copied, not shifted
+            if (!ft::is_nothrow_relocatable<value_type>::value && first != begin() && last != end()) {
+                copy_erase(first, last);
+                return begin() + offset;
+            }
+            destroy_range(first, last);
+            if (end() - last < offset) { // shift succeeding elements to the left
+                map_pointer last_slot = _last.get_map();
+                relocate(first, last, end() - last);
+                _last -= n;
+                release_chunks(_last.get_map() + 1, last_slot + 1);
             } else { // shift preceding elements to the right
-                tmp = first;
-                for (iterator it = begin(); it != first; ++it, ++tmp) {
-                    _alloc.construct(tmp.get_curr(), *it);
-                    _alloc.destroy(it.get_curr());
-                }
-                _first = _last - _size - 1;
-                _last = _first + _size + 1;
+                map_pointer first_slot = _first.get_map();
+                relocate(begin() + n, begin(), offset);
+                _first += n;
+                release_chunks(first_slot, _first.get_map());
             }
+            _size -= n;
             return begin() + offset;
         }
 
@@ -308,72 +456,569 @@ class deque
             ft::swap(_last, x._last);
             ft::swap(_size, x._size);
             ft::swap(_map_size, x._map_size);
+            for (size_type i = 0; i < max_spare_chunks; ++i)
+                ft::swap(_spare[i], x._spare[i]);
+            ft::swap(_spare_count, x._spare_count);
             ft::swap(_alloc, x._alloc);
             ft::swap(_ptr_alloc, x._ptr_alloc);
-            //ft::swap(_chunk_size, x._chunk_size);
         }
 
         void clear(void)
         {
-            iterator ite = end();
-            for (iterator it = begin(); it != ite; ++it)
-                _alloc.destroy(it.get_curr());
-            _first = iterator(_map[_map_size / 2] + (chunk_size / 2), _map + _map_size / 2);
+            if (!_map)
+                return ;
+            destroy_range(begin(), end());
+            // restart from the middle of the chunk _first is in
+            release_chunks(_first.get_map() + 1, _last.get_map() + 1);
+            _first.set_curr(*_first.get_map() + (chunk_size - 1) / 2);
             _last = _first + 1;
             _size = 0;
         }
 
     private:
+        static const size_type max_spare_chunks = 2;
+
         map_pointer _map;
         iterator _first;
         iterator _last;
         size_type _size;
         size_type _map_size;
+        pointer _spare[max_spare_chunks];
+        size_type _spare_count;
         allocator_type _alloc;
         ptr_allocator_type _ptr_alloc;
 
-        // TODO: add arg to set new map size
-        void realloc_map (bool at_front)
-        {
-            map_pointer tmp = _ptr_alloc.allocate(_map_size + 1);
-            if (at_front) { // add an empty chunk at the beginning of the map
-                // + 1 to account for added array
-                difference_type offset = _last.get_map() - _map + 1;
-                tmp[0] = _alloc.allocate(chunk_size);
-                for (size_t i = 0; i < _map_size; ++i)
-                    tmp[i + 1] = _map[i];
-                _first.set_map(tmp);
-                _first.set_curr(*tmp + chunk_size - 1);
-                _last.set_map(tmp + offset);
-            } else { // add an empty chunk at the end of the map
-                difference_type offset = _first.get_map() - _map;
-                tmp[_map_size] = _alloc.allocate(chunk_size);
-                for (size_t i = 0; i < _map_size; ++i)
-                    tmp[i] = _map[i];
-                _first.set_map(tmp + offset);
-                _last.set_map(tmp + _map_size);
-                _last.set_curr(tmp[_map_size]);
+        /* BULK CONSTRUCTION */
+        template <class InputIterator>
+        void append (InputIterator first, InputIterator last, std::input_iterator_tag)
+        {
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        template <class ForwardIterator>
+        void append (ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+        {
+            size_type n = std::distance(first, last);
+            if (n == 0)
+                return ;
+            reserve_slots(n, false);
+            construct_range(_last, first, n);
+            _last += n;
+            _size += n;
+        }
+
+        // the elements are pushed in front one by one, then put back in order
+        template <class InputIterator>
+        void prepend (InputIterator first, InputIterator last, std::input_iterator_tag)
+        {
+            size_type n = 0;
+            for (; first != last; ++first, ++n)
+                push_front(*first);
+            for (size_type i = 0; i < n / 2; ++i)
+                ft::swap((*this)[i], (*this)[n - 1 - i]);
+        }
+
+        template <class ForwardIterator>
+        void prepend (ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+        {
+            size_type n = std::distance(first, last);
+            if (n == 0)
+                return ;
+            reserve_slots(n, true);
+            construct_range(_first + (1 - difference_type(n)), first, n);
+            _first -= n;
+            _size += n;
+        }
+
+        // builds n elements from src in the unconstructed slots from dst on
+        template <class ForwardIterator>
+        void construct_range (iterator dst, ForwardIterator src, size_type n)
+        {
+            while (n > 0) {
+                size_type run = ft::min(n, size_type(chunk_end(dst)));
+                src = construct_run(dst.get_curr(), src, run);
+                n -= run;
+                if (n > 0)
+                    dst += run;
             }
+        }
+
+        template <class InputIterator>
+        typename ft::enable_if< !contiguous_iterator_traits<InputIterator>::is_contiguous, InputIterator >::type
+        construct_run (pointer dst, InputIterator src, size_type n)
+        {
+            for (size_type i = 0; i < n; ++i, ++src)
+                _alloc.construct(dst + i, *src);
+            return src;
+        }
+
+        template <class ContiguousIterator>
+        typename ft::enable_if< contiguous_iterator_traits<ContiguousIterator>::is_contiguous, ContiguousIterator >::type
+        construct_run (pointer dst, ContiguousIterator src, size_type n)
+        {
+            typedef contiguous_iterator_traits<ContiguousIterator> traits;
+
+            if (ft::is_same<typename traits::value_type, value_type>::value
+                && ft::is_trivially_copyable<value_type>::value) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(traits::address(src)), n * sizeof(value_type));
+                return src + n;
+            }
+            for (size_type i = 0; i < n; ++i, ++src)
+                _alloc.construct(dst + i, *src);
+            return src;
+        }
+
+        // the slots are raw storage, trivially copyable elements are
+        // copied in with their bytes & never assigned
+        void construct_fill (pointer dst, size_type n, const value_type& val)
+        {
+            if (ft::is_trivially_copyable<value_type>::value) {
+                for (size_type i = 0; i < n; ++i)
+                    std::memcpy(static_cast<void*>(dst + i), static_cast<const void*>(&val), sizeof(value_type));
+                return ;
+            }
+            for (size_type i = 0; i < n; ++i)
+                _alloc.construct(dst + i, val);
+        }
+
+        /* MAP MANAGEMENT */
+        // a deque has no map until its first push. the slots of the map
+        // between the chunks of _first & _last hold a chunk, the others are
+        // NULL. the chunks left by _first & _last are kept as spares for the
+        // next chunk either end needs, up to max_spare_chunks of them
+
+        // makes sure _first can move n slots backward or _last n slots
+        // forward without leaving the chunks of the map
+        void reserve_slots (size_type n, bool at_front)
+        {
+            if (!_map)
+                initialize_map();
+            size_type room = at_front ? chunk_begin(_first) - 1 : chunk_end(_last) - 1;
+            if (n <= room)
+                return ;
+            size_type chunks = (n - room + chunk_size - 1) / chunk_size;
+            reserve_map(chunks, at_front);
+            for (size_type i = 1; i <= chunks; ++i) {
+                if (at_front)
+                    _first.get_map()[-difference_type(i)] = new_chunk();
+                else
+                    _last.get_map()[i] = new_chunk();
+            }
+        }
+
+        pointer new_chunk (void)
+        {
+            if (_spare_count)
+                return _spare[--_spare_count];
+            return _alloc.allocate(chunk_size);
+        }
+
+        // empties the slots [first, last) of the map, their chunks are kept
+        // as spares or released
+        void release_chunks (map_pointer first, map_pointer last)
+        {
+            for (; first < last; ++first) {
+                if (_spare_count < max_spare_chunks)
+                    _spare[_spare_count++] = *first;
+                else
+                    _alloc.deallocate(*first, chunk_size);
+                *first = NULL;
+            }
+        }
+
+        // the elements must have been destroyed
+        void release_map (void)
+        {
+            while (_spare_count)
+                _alloc.deallocate(_spare[--_spare_count], chunk_size);
+            if (!_map)
+                return ;
+            for (map_pointer slot = _first.get_map(); slot <= _last.get_map(); ++slot)
+                _alloc.deallocate(*slot, chunk_size);
             _ptr_alloc.deallocate(_map, _map_size);
-            _map = tmp;
-            ++_map_size;
         }
 
-        void initialize_map (void)
+        // makes room for n more slots in front of _first's or after _last's
+        void reserve_map (size_type n, bool at_front)
+        {
+            size_type free_slots = at_front ? _first.get_map() - _map : _map + _map_size - 1 - _last.get_map();
+            if (n > free_slots)
+                realloc_map(n, at_front);
+        }
+
+        // the used slots are recentered inside the map if it is more than
+        // twice as large as needed, otherwise a map at least twice as large
+        // is allocated, either way the map management is amortized O(1)
+        void realloc_map (size_type n, bool at_front)
+        {
+            map_pointer first_slot = _first.get_map();
+            size_type used = _last.get_map() - first_slot + 1;
+            size_type needed = used + n;
+            map_pointer new_map = _map;
+            size_type new_map_size = _map_size;
+            if (_map_size <= 2 * needed) {
+                new_map_size = _map_size + ft::max(_map_size, n) + 2;
+                new_map = _ptr_alloc.allocate(new_map_size);
+            }
+            map_pointer new_first_slot = new_map + (new_map_size - needed) / 2 + (at_front ? n : 0);
+
+            std::memmove(new_first_slot, first_slot, used * sizeof(*_map));
+            for (size_type i = 0; i < new_map_size; ++i) {
+                if (new_map + i < new_first_slot || new_map + i >= new_first_slot + used)
+                    new_map[i] = NULL;
+            }
+            if (new_map != _map) {
+                _ptr_alloc.deallocate(_map, _map_size);
+                _map = new_map;
+                _map_size = new_map_size;
+            }
+            _first.set_map(new_first_slot);
+            _last.set_map(new_first_slot + used - 1);
+        }
+
+        /* GAPS */
+        // builders construct the elements insert_gap puts in a gap
+        struct fill_builder
+        {
+            const value_type& val;
+
+            void operator() (allocator_type& alloc, pointer dst) { alloc.construct(dst, val); }
+        };
+
+        template <class InputIterator>
+        struct range_builder
+        {
+            InputIterator it;
+
+            void operator() (allocator_type& alloc, pointer dst) { alloc.construct(dst, *it); ++it; }
+        };
+
+#ifdef FT_HAS_CXX11
+        struct move_builder
+        {
+            value_type& val;
+
+            void operator() (allocator_type& alloc, pointer dst) { alloc.construct(dst, std::move(val)); }
+        };
+#endif
+
+        // erasing builds nothing
+        struct no_builder
+        {
+            void operator() (allocator_type&, pointer) {}
+        };
+
+        // builds n elements with build before the element at index i. the
+        // elements which may throw while moved are copied to new chunks
+        // instead of being shifted, unless none of them has to move
+        template <class Build>
+        void insert_gap (size_type i, size_type n, Build build)
+        {
+            if (!ft::is_nothrow_relocatable<value_type>::value && i != 0 && i != _size) {
+                copy_gap(i, n, build);
+                return ;
+            }
+            iterator gap = make_gap(i, n);
+            gap_guard guard = { *this, i, n, 0 };
+            for (; guard.built < n; ++guard.built, ++gap)
+                build(_alloc, gap.get_curr());
+            _size += n;
+        }
+
+        // the gap insert_gap opened, if building an element throws the ones
+        // already built are destroyed & the gap is closed again
+        struct gap_guard
+        {
+            deque& dq;
+            size_type i;
+            size_type n;
+            size_type built;
+
+            ~gap_guard()
+            {
+                if (built != n)
+                    dq.close_gap(i, n, built);
+            }
+        };
+
+        /* COPYING SHIFTS */
+        // a shift which throws halfway can't be undone, so the elements
+        // which may throw while moved never are: the chunks the shift
+        // touches are rebuilt in new chunks, with copies of their elements,
+        // & the old elements are only destroyed & their chunks replaced
+        // once every copy is built
+
+        // new chunks for the slots from first's on, their elements are
+        // destroyed & the chunks freed unless install_chunks took them. the
+        // last slot of chunks stays NULL for an iterator stepping past the
+        // last element
+        struct chunk_copy
+        {
+            deque& dq;
+            map_pointer chunks;
+            size_type count;
+            size_type allocated;
+            iterator first;
+            size_type built;
+
+            ~chunk_copy()
+            {
+                if (!chunks)
+                    return ;
+                iterator it = first;
+                for (size_type i = 0; i < built; ++i, ++it)
+                    dq._alloc.destroy(it.get_curr());
+                for (size_type i = 0; i < allocated; ++i)
+                    dq._alloc.deallocate(chunks[i], chunk_size);
+                dq._ptr_alloc.deallocate(chunks, count + 1);
+            }
+        };
+
+        // the n new elements go before the element at index i, the side
+        // which is shifted is rebuilt along with the rest of the chunks it
+        // shares with the side which stays
+        template <class Build>
+        void copy_gap (size_type i, size_type n, Build build)
+        {
+            if (i < _size - i) {
+                reserve_slots(n, true);
+                iterator pos = begin() + i;
+                iterator last = pos + ft::min(difference_type(_size - i), chunk_end(pos - 1) - 1);
+                copy_shift(begin(), pos, pos, last, begin() - n, n, build);
+            } else {
+                reserve_slots(n, false);
+                iterator pos = begin() + i;
+                iterator first = pos - ft::min(difference_type(i), chunk_begin(pos) - 1);
+                copy_shift(first, pos, pos, end(), first, n, build);
+            }
+        }
+
+        // neither first nor last is an end of the deque
+        void copy_erase (iterator first, iterator last)
         {
+            no_builder build;
+            if (end() - last < first - begin()) {
+                iterator from = first - ft::min(first - begin(), chunk_begin(first) - 1);
+                copy_shift(from, first, last, end(), from, 0, build);
+            } else {
+                iterator to = last + ft::min(end() - last, chunk_end(last - 1) - 1);
+                copy_shift(begin(), first, last, to, begin() + (last - first), 0, build);
+            }
+        }
+
+        // replaces the elements of [first, last) with copies of [first, pos)
+        // followed by n elements built with build & copies of [resume, last),
+        // laid out from the slot dst on. the slots from dst to the last copy
+        // must have a chunk
+        template <class Build>
+        void copy_shift (iterator first, iterator pos, iterator resume, iterator last, iterator dst, size_type n, Build build)
+        {
+            size_type new_size = _size - (resume - pos) + n;
+            difference_type kept = first - begin();
+            iterator dst_last = dst + ((pos - first) + difference_type(n) + (last - resume) - 1);
+            size_type count = dst_last.get_map() - dst.get_map() + 1;
+            chunk_copy copy = { *this, _ptr_alloc.allocate(count + 1), count, 0, iterator(), 0 };
+            copy.chunks[count] = NULL;
+            for (; copy.allocated < count; ++copy.allocated)
+                copy.chunks[copy.allocated] = _alloc.allocate(chunk_size);
+            difference_type offset = dst.get_curr() - *dst.get_map();
+            copy.first = iterator(copy.chunks[0] + offset, copy.chunks);
+
+            iterator out = copy.first;
+            for (iterator it = first; it != pos; ++it, ++out, ++copy.built)
+                copy_one(out.get_curr(), *it);
+            for (size_type i = 0; i < n; ++i, ++out, ++copy.built)
+                build(_alloc, out.get_curr());
+            for (iterator it = resume; it != last; ++it, ++out, ++copy.built)
+                copy_one(out.get_curr(), *it);
+
+            destroy_range(first, last);
+            map_pointer first_slot = _first.get_map();
+            map_pointer last_slot = _last.get_map();
+            map_pointer slot = dst.get_map();
+            for (size_type i = 0; i < count; ++i) {
+                release_chunks(slot + i, slot + i + 1);
+                slot[i] = copy.chunks[i];
+            }
+            _ptr_alloc.deallocate(copy.chunks, count + 1);
+            copy.chunks = NULL;
+
+            _first = iterator(*slot + offset, slot) - (kept + 1);
+            _last = _first + difference_type(new_size + 1);
+            _size = new_size;
+            release_chunks(first_slot, _first.get_map());
+            release_chunks(_last.get_map() + 1, last_slot + 1);
+        }
+
+        /* RELOCATION */
+        // opens n unconstructed slots before the element at index i by
+        // shifting the elements preceding or succeeding it, whichever are
+        // fewer, returns the first slot of the gap. _size is left as is
+        iterator make_gap (size_type i, size_type n)
+        {
+            if (i < _size - i) {
+                reserve_slots(n, true);
+                relocate(_first + (1 - difference_type(n)), _first + 1, i);
+                _first -= n;
+            } else {
+                reserve_slots(n, false);
+                iterator position = begin() + i;
+                relocate(position + n, position, _size - i);
+                _last += n;
+            }
+            return begin() + i;
+        }
+
+        // destroys the first built elements of the gap make_gap(i, n) opened
+        // & shifts back the elements it moved, their chunks are released
+        void close_gap (size_type i, size_type n, size_type built)
+        {
+            iterator gap = begin() + i;
+            destroy_range(gap, gap + built);
+            if (i < _size - i) {
+                map_pointer first_slot = _first.get_map();
+                relocate(begin() + n, begin(), i);
+                _first += n;
+                release_chunks(first_slot, _first.get_map());
+            } else {
+                map_pointer last_slot = _last.get_map();
+                relocate(gap, gap + n, _size - i);
+                _last -= n;
+                release_chunks(_last.get_map() + 1, last_slot + 1);
+            }
+        }
+
+        // moves the n elements starting at src to the unconstructed slots
+        // starting at dst, the ranges may overlap. the elements are moved
+        // by runs which are contiguous in both the source & destination
+        // chunks, with a single memmove for trivially relocatable types
+        void relocate (iterator dst, iterator src, difference_type n)
+        {
+            if (n <= 0 || dst == src)
+                return ;
+            if (dst < src) {
+                while (n > 0) {
+                    difference_type run = ft::min(n, ft::min(chunk_end(dst), chunk_end(src)));
+                    relocate_run(dst.get_curr(), src.get_curr(), run);
+                    n -= run;
+                    if (n == 0)
+                        break ;
+                    dst += run;
+                    src += run;
+                }
+            } else { // move the last elements first
+                iterator dst_back = dst + (n - 1);
+                iterator src_back = src + (n - 1);
+                while (n > 0) {
+                    difference_type run = ft::min(n, ft::min(chunk_begin(dst_back), chunk_begin(src_back)));
+                    relocate_run(dst_back.get_curr() - run + 1, src_back.get_curr() - run + 1, run);
+                    n -= run;
+                    if (n == 0)
+                        break ;
+                    dst_back -= run;
+                    src_back -= run;
+                }
+            }
+        }
+
+        // ranges within a single chunk each
+        void relocate_run (pointer dst, pointer src, difference_type n)
+        {
+            if (ft::is_trivially_relocatable<value_type>::value) {
+                std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            } else if (dst < src) {
+                for (difference_type i = 0; i < n; ++i)
+                    relocate_one(dst + i, src + i);
+            } else {
+                for (difference_type i = n; i > 0; --i)
+                    relocate_one(dst + i - 1, src + i - 1);
+            }
+        }
+
+        void relocate_one (pointer dst, pointer src)
+        {
+#ifdef FT_HAS_CXX11
+            _alloc.construct(dst, std::move_if_noexcept(*src));
+#else
+            _alloc.construct(dst, *src);
+#endif
+            _alloc.destroy(src);
+        }
+
+        // the types which can only be moved are moved
+        void copy_one (pointer dst, reference src)
+        {
+#ifdef FT_HAS_CXX11
+            _alloc.construct(dst, std::move_if_noexcept(src));
+#else
+            _alloc.construct(dst, src);
+#endif
+        }
+
+        // trivially copyable types have nothing to destroy
+        void destroy_range (iterator first, iterator last)
+        {
+            if (ft::is_trivially_copyable<value_type>::value)
+                return ;
+            ft::for_each(first, last, destroyer(&_alloc));
+        }
+
+        struct destroyer
+        {
+            allocator_type * alloc;
+
+            destroyer (allocator_type * a) : alloc(a) {}
+            void operator() (reference x) { alloc->destroy(&x); }
+        };
+
+        // the element n lies i = offset of _first in its chunk + n + 1 slots
+        // after the start of _first's chunk, its chunk & its slot are found
+        // with a division by the constant chunk_size, a shift & a mask when
+        // chunk_size is a power of two, without any branch
+        pointer element (size_type n) const
+        {
+            map_pointer slot = _first.get_map();
+            size_type i = _first.get_curr() - *slot + n + 1;
+            return slot[i / chunk_size] + i % chunk_size;
+        }
+
+        // number of slots from it to the end of its chunk, it included
+        static difference_type chunk_end (const iterator& it) { return *it.get_map() + chunk_size - it.get_curr(); }
+        // number of slots from the start of its chunk to it, it included
+        static difference_type chunk_begin (const iterator& it) { return it.get_curr() - *it.get_map() + 1; }
+
+        void initialize_empty (void)
+        {
+            _map = NULL;
+            _first = iterator();
+            _last = iterator();
             _size = 0;
+            _map_size = 0;
+            for (size_type i = 0; i < max_spare_chunks; ++i)
+                _spare[i] = NULL;
+            _spare_count = 0;
+        }
+
+        // a map with a single chunk in its middle
+        void initialize_map (void)
+        {
             _map_size = 8;
             _map = _ptr_alloc.allocate(_map_size);
             for (size_type i = 0; i < _map_size; ++i)
-                _map[i] = _alloc.allocate(chunk_size);
-            _first = iterator(_map[_map_size / 2] + (chunk_size / 2), _map + _map_size / 2);
+                _map[i] = NULL;
+            _map[_map_size / 2] = new_chunk();
+            _first = iterator(_map[_map_size / 2] + (chunk_size - 1) / 2, _map + _map_size / 2);
             _last = _first + 1;
         }
 
 }; // CLASS DEQUE
 
-template <class T, class Alloc>
-void swap (deque<T, Alloc>& x, deque<T, Alloc>& y)
+template <class T, class Alloc, class ChunkPolicy>
+const size_t deque<T, Alloc, ChunkPolicy>::chunk_size;
+
+template <class T, class Alloc, class ChunkPolicy>
+void swap (deque<T, Alloc, ChunkPolicy>& x, deque<T, Alloc, ChunkPolicy>& y)
 {
     x.swap(y);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../utils/utils.hpp"
+#include "../utils/algorithm.hpp" // segmented_iterator_traits
 #include <cstddef> // NULL, std::ptrdiff_t, size_t
 #include <iterator> // std::random_access_iterator_tag
 
@@ -120,6 +121,9 @@ class deque_iterator
         /* ITERATOR & INTEGER ARITHMETIC */
         self_type& operator+= (difference_type n)
         {
+            // the iterators of an empty deque may not point into any chunk
+            if (n == 0)
+                return *this;
             difference_type distance_to_start = distance_2_start();
             difference_type distance_to_end = distance_2_end();
 
@@ -179,6 +183,23 @@ class deque_iterator
 
 }; // CLASS DEQUE_ITERATOR
 
+// the segments of a deque are its chunks, the slots of its map
+template <class T, size_t chunk_size, bool is_const>
+struct segmented_iterator_traits< deque_iterator<T, chunk_size, is_const> >
+{
+    static const bool is_segmented = true;
+
+    typedef deque_iterator<T, chunk_size, is_const> iterator;
+    typedef T** segment_iterator;
+    typedef typename iterator::pointer local_iterator;
+
+    static segment_iterator segment (const iterator& it) { return it.get_map(); }
+    static local_iterator local (const iterator& it) { return it.get_curr(); }
+    static local_iterator begin (segment_iterator seg) { return *seg; }
+    static local_iterator end (segment_iterator seg) { return *seg + chunk_size; }
+    static iterator compose (segment_iterator seg, local_iterator local) { return iterator(local, seg); }
+};
+
 template <class T, size_t chunk_size, bool is_const>
 class reverse_deque_iterator
 {
@@ -293,6 +314,9 @@ class reverse_deque_iterator
         /* ITERATOR & INTEGER ARITHMETIC */
         self_type& operator+= (difference_type n)
         {
+            // the iterators of an empty deque may not point into any chunk
+            if (n == 0)
+                return *this;
             difference_type distance_to_start = distance_2_start();
             difference_type distance_to_end = distance_2_end();
 
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../tree/avl_node.hpp"
+
+#include <cstddef> // NULL
+
+namespace ft {
+
+// the links, height & subtree size an element embeds to be put in an
+// intrusive_avl_set, the hook is in one set at most & an element is in
+// several sets at once through several hooks. a copy starts unlinked & an
+// assignment keeps the links, like list_hook
+struct avl_set_hook : avl_node_base
+{
+    avl_set_hook (void)
+        : avl_node_base()
+    {
+    }
+
+    avl_set_hook (const avl_set_hook&)
+        : avl_node_base()
+    {
+    }
+
+    avl_set_hook& operator= (const avl_set_hook&) { return *this; }
+
+    // the root hangs below the header, a linked hook always has a parent
+    bool is_linked (void) const { return parent != NULL; }
+
+}; // STRUCT AVL_SET_HOOK
+
+} // NAMESPACE FT
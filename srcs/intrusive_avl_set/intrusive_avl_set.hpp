@@ -0,0 +1,340 @@
+#pragma once
+
+#include "avl_set_hook.hpp"
+#include "intrusive_avl_set_iterator.hpp"
+#include "../tree/avl_node.hpp"
+#include "../utils/utils.hpp" // ft::enable_if, ft::member_hook
+
+#include <cstddef> // NULL, std::ptrdiff_t, size_t
+#include <cassert> // assert
+
+#include <limits> // std::numeric_limits
+#include <functional> // std::less
+#include <utility> // std::pair
+
+namespace ft {
+
+// a set of unique elements it does not own, linked through their Hook
+// member e.g intrusive_avl_set<entry, &entry::by_key, by_key_less>. it is
+// balanced like avl_tree with the same header scheme, nothing is allocated
+// & an element is unlinked from its hook without a lookup. the elements
+// have to stay alive & in place while linked & the part Compare looks at
+// may not change, the rest of an element can be modified through the set
+template <class T, avl_set_hook T::* Hook, class Compare = std::less<T> >
+class intrusive_avl_set
+{
+    public:
+        typedef T key_type;
+        typedef T value_type;
+        typedef Compare key_compare;
+        typedef Compare value_compare;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef intrusive_avl_set_iterator<value_type, Hook, false> iterator;
+        typedef intrusive_avl_set_iterator<value_type, Hook, true> const_iterator;
+        typedef reverse_intrusive_avl_set_iterator<value_type, Hook, false> reverse_iterator;
+        typedef reverse_intrusive_avl_set_iterator<value_type, Hook, true> const_reverse_iterator;
+        typedef std::ptrdiff_t difference_type;
+        typedef size_t size_type;
+
+    private:
+        typedef member_hook<value_type, avl_set_hook, Hook> hook_traits;
+        typedef avl_node_base* base_pointer;
+
+    public:
+        /* CONSTRUCTORS */
+        explicit intrusive_avl_set (const key_compare& comp = key_compare())
+            : _comp(comp), _root(NULL), _size(0)
+        {
+            initialize_header();
+        }
+
+        // links the elements [first, last) refer to, the ones whose key is
+        // already present are left unlinked
+        template <class InputIterator>
+        intrusive_avl_set (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+            : _comp(comp), _root(NULL), _size(0)
+        {
+            initialize_header();
+            insert(first, last);
+        }
+
+#ifdef FT_HAS_CXX11
+        // x is left empty
+        intrusive_avl_set (intrusive_avl_set&& x)
+            : _comp(x._comp), _root(NULL), _size(0)
+        {
+            initialize_header();
+            swap(x);
+        }
+
+        /* OPERATORS */
+        intrusive_avl_set& operator= (intrusive_avl_set&& x)
+        {
+            if (this != &x) {
+                clear();
+                swap(x);
+            }
+            return *this;
+        }
+#endif
+
+        /* DESTRUCTOR */
+        // the elements outlive the set, their hooks are left unlinked
+        ~intrusive_avl_set()
+        {
+            clear();
+        }
+
+        /* ITERATORS */
+        // the header ends the traversal in both directions
+        iterator begin() { return iterator(_header.right); }
+        const_iterator begin() const { return const_iterator(_header.right); }
+        iterator end() { return iterator(header()); }
+        const_iterator end() const { return const_iterator(header()); }
+        reverse_iterator rbegin() { return reverse_iterator(_root ? avl_max(_root) : header()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(_root ? avl_max(_root) : header()); }
+        reverse_iterator rend() { return reverse_iterator(header()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(header()); }
+
+        // the iterator to an element linked in this set, found from its
+        // hook without a lookup
+        iterator iterator_to (reference val) { return iterator(hook_traits::to_hook(val)); }
+        const_iterator iterator_to (const_reference val) const { return const_iterator(&(val.*Hook)); }
+
+        /* CAPACITY */
+        size_type size (void) const { return _size; }
+        bool empty (void) const { return _size == 0; }
+
+        /* MODIFIERS */
+        // val is linked unless an element with the same key already is, it
+        // may not be linked through its Hook already
+        std::pair<iterator, bool> insert (reference val)
+        {
+            assert(!(val.*Hook).is_linked());
+            unset_bounds();
+            base_pointer parent = NULL;
+            base_pointer * link = &_root;
+            while (*link) {
+                parent = *link;
+                if (_comp(val, value_of(parent))) {
+                    link = &parent->left;
+                } else if (_comp(value_of(parent), val)) {
+                    link = &parent->right;
+                } else {
+                    set_bounds();
+                    return std::make_pair(iterator(parent), false);
+                }
+            }
+            base_pointer node = hook_traits::to_hook(val);
+            avl_link(node, parent, link, _root);
+            ++_size;
+            set_bounds();
+            return std::make_pair(iterator(node), true);
+        }
+
+        template <class InputIterator>
+        void insert (InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+        {
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        void erase (iterator position)
+        {
+            base_pointer node = position.get_node();
+            --_size;
+            unset_bounds();
+            avl_erase(node, _root);
+            reset(node);
+            set_bounds();
+        }
+
+        size_type erase (const key_type& k)
+        {
+            iterator it = find(k);
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        void erase (iterator first, iterator last)
+        {
+            for (iterator tmp = first; first != last; first = tmp) {
+                ++tmp;
+                erase(first);
+            }
+        }
+
+        // no lookup, val has to be linked in this set
+        void unlink (reference val)
+        {
+            erase(iterator_to(val));
+        }
+
+        // the headers stay in place, only the roots & the min hooks are
+        // relinked to their new header
+        void swap (intrusive_avl_set& x)
+        {
+            ft::swap(_comp, x._comp);
+            ft::swap(_root, x._root);
+            ft::swap(_header.right, x._header.right);
+            ft::swap(_size, x._size);
+            attach_root();
+            x.attach_root();
+        }
+
+        // every hook is reset so that the elements can be linked again
+        void clear (void)
+        {
+            aux_clear(_root);
+            _root = NULL;
+            _size = 0;
+            set_bounds();
+        }
+
+        /* OBSERVERS */
+        key_compare key_comp (void) const { return _comp; }
+        value_compare value_comp (void) const { return _comp; }
+
+        /* OPERATIONS */
+        size_type count (const key_type& k) const
+        {
+            return aux_find(k) != header() ? 1 : 0;
+        }
+
+        iterator find (const key_type& k) { return iterator(aux_find(k)); }
+        const_iterator find (const key_type& k) const { return const_iterator(aux_find(k)); }
+
+        // lower_bound returns iterator to first element that is not less than k
+        // upper_bound returns iterator to first element that is greater than k
+        iterator lower_bound (const key_type& k) { return iterator(aux_lower_bound(k)); }
+        const_iterator lower_bound (const key_type& k) const { return const_iterator(aux_lower_bound(k)); }
+        iterator upper_bound (const key_type& k) { return iterator(aux_upper_bound(k)); }
+        const_iterator upper_bound (const key_type& k) const { return const_iterator(aux_upper_bound(k)); }
+
+    private:
+        key_compare _comp;
+        base_pointer _root;
+        // holds no value, it is not part of any element
+        avl_node_base _header;
+        size_type _size;
+
+        // copying would link the same hooks in two sets
+        intrusive_avl_set (const intrusive_avl_set&);
+        intrusive_avl_set& operator= (const intrusive_avl_set&);
+
+        static const value_type& value_of (const avl_node_base* node) { return *hook_traits::to_value(static_cast<const avl_set_hook*>(node)); }
+
+        base_pointer header (void) const { return const_cast<base_pointer>(&_header); }
+
+        static void reset (base_pointer node)
+        {
+            node->height = 0;
+            node->size = 1;
+            node->left = NULL;
+            node->right = NULL;
+            node->parent = NULL;
+        }
+
+        /* LOOKUP */
+        base_pointer aux_find (const key_type& k) const
+        {
+            base_pointer node = _root;
+            while (node) {
+                if (_comp(value_of(node), k))
+                    node = node->right;
+                else if (_comp(k, value_of(node)))
+                    node = node->left;
+                else
+                    return node;
+            }
+            return header();
+        }
+
+        base_pointer aux_lower_bound (const key_type& k) const
+        {
+            base_pointer node = _root;
+            base_pointer bound = header();
+            while (node) {
+                if (!_comp(value_of(node), k)) {
+                    bound = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return bound;
+        }
+
+        base_pointer aux_upper_bound (const key_type& k) const
+        {
+            base_pointer node = _root;
+            base_pointer bound = header();
+            while (node) {
+                if (_comp(k, value_of(node))) {
+                    bound = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return bound;
+        }
+
+        /* HEADER */
+        // the header is its own parent & points to itself as the min node
+        // of an empty set, so begin() == end()
+        void initialize_header (void)
+        {
+            _header.size = 0;
+            _header.parent = &_header;
+            _header.right = &_header;
+        }
+
+        // the root is detached from the header while the set is modified,
+        // the shared avl functions expect a root without parent
+        void unset_bounds (void)
+        {
+            if (_root)
+                _root->parent = NULL;
+        }
+
+        void set_bounds (void)
+        {
+            _header.right = _root ? avl_min(_root) : &_header;
+            attach_root();
+        }
+
+        void attach_root (void)
+        {
+            _header.left = _root;
+            if (_root)
+                _root->parent = &_header;
+            else
+                _header.right = &_header;
+        }
+
+        void aux_clear (base_pointer node)
+        {
+            if (!node)
+                return ;
+            aux_clear(node->left);
+            aux_clear(node->right);
+            reset(node);
+        }
+
+}; // CLASS INTRUSIVE_AVL_SET
+
+template <class T, avl_set_hook T::* Hook, class Compare>
+void swap (intrusive_avl_set<T, Hook, Compare>& x, intrusive_avl_set<T, Hook, Compare>& y)
+{
+    x.swap(y);
+}
+
+} // NAMESPACE FT
@@ -0,0 +1,273 @@
+#pragma once
+
+#include "list_hook.hpp"
+#include "intrusive_list_iterator.hpp"
+#include "../utils/utils.hpp" // ft::enable_if, ft::member_hook
+
+#include <cstddef> // NULL, std::ptrdiff_t, size_t
+#include <cassert> // assert
+
+#include <limits> // std::numeric_limits
+#include <iterator> // std::distance
+
+namespace ft {
+
+// a list linking elements it does not own through their Hook member e.g
+// intrusive_list<entry, &entry::lru_hook>, nothing is allocated: inserting
+// links the hook & erasing unlinks it, the element itself is never copied
+// nor destroyed. an element found by any other mean is unlinked in O(1),
+// it has to stay alive & in place while it is linked
+template <class T, list_hook T::* Hook>
+class intrusive_list
+{
+    public:
+        typedef T value_type;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef intrusive_list_iterator<value_type, Hook, false> iterator;
+        typedef intrusive_list_iterator<value_type, Hook, true> const_iterator;
+        typedef reverse_intrusive_list_iterator<value_type, Hook, false> reverse_iterator;
+        typedef reverse_intrusive_list_iterator<value_type, Hook, true> const_reverse_iterator;
+        typedef std::ptrdiff_t difference_type;
+        typedef size_t size_type;
+
+    private:
+        typedef member_hook<value_type, list_hook, Hook> hook_traits;
+        typedef list_node_base* base_pointer;
+
+    public:
+        /* CONSTRUCTORS */
+        intrusive_list (void)
+            : _size(0)
+        {
+            initialize_sentinel();
+        }
+
+        // links the elements [first, last) refer to
+        template <class InputIterator>
+        intrusive_list (InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+            : _size(0)
+        {
+            initialize_sentinel();
+            insert(end(), first, last);
+        }
+
+#ifdef FT_HAS_CXX11
+        // x is left empty
+        intrusive_list (intrusive_list&& x)
+            : _size(0)
+        {
+            initialize_sentinel();
+            swap(x);
+        }
+
+        /* OPERATORS */
+        intrusive_list& operator= (intrusive_list&& x)
+        {
+            if (this != &x) {
+                clear();
+                swap(x);
+            }
+            return *this;
+        }
+#endif
+
+        /* DESTRUCTOR */
+        // the elements outlive the list, their hooks are left unlinked
+        ~intrusive_list()
+        {
+            clear();
+        }
+
+        /* ITERATORS */
+        // the sentinel ends the ring in both directions
+        iterator begin() { return iterator(_sentinel.next); }
+        const_iterator begin() const { return const_iterator(_sentinel.next); }
+        iterator end() { return iterator(&_sentinel); }
+        const_iterator end() const { return const_iterator(&_sentinel); }
+        reverse_iterator rbegin() { return reverse_iterator(_sentinel.prev); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(_sentinel.prev); }
+        reverse_iterator rend() { return reverse_iterator(&_sentinel); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(&_sentinel); }
+
+        // the iterator to an element linked in this list, found from its
+        // hook without walking the list
+        iterator iterator_to (reference val) { return iterator(hook_traits::to_hook(val)); }
+        const_iterator iterator_to (const_reference val) const { return const_iterator(&(val.*Hook)); }
+
+        /* CAPACITY */
+        bool empty() const { return _size == 0; }
+        size_type size() const { return _size; }
+
+        /* ELEMENT ACCESS */
+        reference front (void) { return *begin(); }
+        const_reference front (void) const { return *begin(); }
+        reference back (void) { return *rbegin(); }
+        const_reference back (void) const { return *rbegin(); }
+
+        /* MODIFIERS */
+        void push_front (reference val) { insert(begin(), val); }
+        void push_back (reference val) { insert(end(), val); }
+        void pop_front (void) { erase(begin()); }
+        void pop_back (void) { erase(iterator(_sentinel.prev)); }
+
+        // val may not be linked through its Hook already
+        iterator insert (iterator position, reference val)
+        {
+            assert(!(val.*Hook).is_linked());
+            base_pointer node = hook_traits::to_hook(val);
+            list_link(node, position.get_node());
+            ++_size;
+            return iterator(node);
+        }
+
+        template <class InputIterator>
+        void insert (iterator position, InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+        {
+            for (; first != last; ++first)
+                insert(position, *first);
+        }
+
+        iterator erase (iterator position)
+        {
+            base_pointer node = position.get_node();
+            ++position;
+            list_unlink(node);
+            reset(node);
+            --_size;
+            return position;
+        }
+
+        iterator erase (iterator first, iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+            return last;
+        }
+
+        // O(1), val has to be linked in this list
+        void unlink (reference val)
+        {
+            erase(iterator_to(val));
+        }
+
+        // the sentinels stay in place, only the first & last hooks are
+        // relinked to their new sentinel
+        void swap (intrusive_list& x)
+        {
+            ft::swap(_size, x._size);
+            ft::swap(_sentinel.next, x._sentinel.next);
+            ft::swap(_sentinel.prev, x._sentinel.prev);
+            relink_sentinel();
+            x.relink_sentinel();
+        }
+
+        // every hook is reset so that the elements can be linked again
+        void clear (void)
+        {
+            base_pointer node = _sentinel.next;
+            while (node != &_sentinel) {
+                base_pointer next = node->next;
+                reset(node);
+                node = next;
+            }
+            _size = 0;
+            initialize_sentinel();
+        }
+
+        /* OPERATIONS */
+        void splice (iterator position, intrusive_list& x)
+        {
+            splice(position, x, x.begin(), x.end(), x._size);
+        }
+
+        void splice (iterator position, intrusive_list& x, iterator i)
+        {
+            iterator next = i;
+            ++next;
+            splice(position, x, i, next, 1);
+        }
+
+        // the hooks stay in the same list when x is *this, their count is
+        // only needed otherwise
+        void splice (iterator position, intrusive_list& x, iterator first, iterator last)
+        {
+            splice(position, x, first, last, &x == this ? 0 : std::distance(first, last));
+        }
+
+        // n has to be the distance from first to last, a caller who knows
+        // it skips the walk over the range
+        void splice (iterator position, intrusive_list& x, iterator first, iterator last, size_type n)
+        {
+            if (first == last)
+                return ;
+            if (&x != this) {
+                _size += n;
+                x._size -= n;
+            }
+            list_transfer(position.get_node(), first.get_node(), last.get_node());
+        }
+
+        template <class Predicate>
+        void remove_if (Predicate pred)
+        {
+            iterator it = begin();
+            while (it != end()) {
+                if (pred(*it))
+                    it = erase(it);
+                else
+                    ++it;
+            }
+        }
+
+        void reverse (void)
+        {
+            list_reverse(&_sentinel);
+        }
+
+    private:
+        size_type _size;
+        // holds no value, it is not part of any element
+        list_node_base _sentinel;
+
+        // copying would link the same hooks in two lists
+        intrusive_list (const intrusive_list&);
+        intrusive_list& operator= (const intrusive_list&);
+
+        static void reset (base_pointer node)
+        {
+            node->prev = NULL;
+            node->next = NULL;
+        }
+
+        /* SENTINEL */
+        void initialize_sentinel (void)
+        {
+            _sentinel.next = &_sentinel;
+            _sentinel.prev = &_sentinel;
+        }
+
+        // points the first & last hooks back to the sentinel
+        void relink_sentinel (void)
+        {
+            if (_size == 0) {
+                initialize_sentinel();
+            } else {
+                _sentinel.next->prev = &_sentinel;
+                _sentinel.prev->next = &_sentinel;
+            }
+        }
+
+}; // CLASS INTRUSIVE_LIST
+
+template <class T, list_hook T::* Hook>
+void swap (intrusive_list<T, Hook>& x, intrusive_list<T, Hook>& y)
+{
+    x.swap(y);
+}
+
+} // NAMESPACE FT
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "list_hook.hpp"
+#include "../utils/utils.hpp"
+
+#include <cstddef> // NULL, std::ptrdiff_t
+
+#include <iterator> // std::bidirectional_iterator_tag
+
+namespace ft {
+
+// walks the ring of hooks like list_iterator, the element is found back
+// from the hook it embeds as its Hook member
+template <class T, list_hook T::* Hook, bool is_const>
+class intrusive_list_iterator
+{
+    public:
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename choose<is_const, const T*, T*>::type pointer;
+        typedef typename choose<is_const, const T&, T&>::type reference;
+        typedef std::bidirectional_iterator_tag iterator_category;
+
+    private:
+        typedef intrusive_list_iterator<value_type, Hook, is_const> self_type;
+        typedef typename choose<is_const, const list_node_base*, list_node_base*>::type node_pointer;
+        typedef typename choose<is_const, const list_hook*, list_hook*>::type hook_pointer;
+        typedef member_hook<value_type, list_hook, Hook> hook_traits;
+
+    public:
+        /* CONSTRUCTORS */
+        intrusive_list_iterator (node_pointer node = NULL)
+            : _node(node)
+        {
+        }
+
+        intrusive_list_iterator (const intrusive_list_iterator<value_type, Hook, false>& other)
+            : _node(other.get_node())
+        {
+        }
+
+        /* OPERATORS */
+        intrusive_list_iterator& operator= (const self_type& other)
+        {
+            if (this != &other)
+                _node = other._node;
+            return *this;
+        }
+
+        friend bool operator== (const self_type& rhs, const self_type& lhs) { return rhs._node == lhs._node; }
+        friend bool operator!= (const self_type& rhs, const self_type& lhs) { return rhs._node != lhs._node; }
+
+        reference operator* (void) { return *hook_traits::to_value(static_cast<hook_pointer>(_node)); }
+        pointer operator-> (void) { return hook_traits::to_value(static_cast<hook_pointer>(_node)); }
+
+        self_type& operator++ (void)
+        {
+            _node = _node->next;
+            return *this;
+        }
+
+        self_type operator++ (int)
+        {
+            self_type tmp = *this;
+            _node = _node->next;
+            return tmp;
+        }
+
+        self_type& operator-- (void)
+        {
+            _node = _node->prev;
+            return *this;
+        }
+
+        self_type operator-- (int)
+        {
+            self_type tmp = *this;
+            _node = _node->prev;
+            return tmp;
+        }
+
+        /* GETTER */
+        node_pointer get_node (void) const { return _node; }
+
+    private:
+        node_pointer _node;
+
+}; // CLASS INTRUSIVE_LIST_ITERATOR
+
+template <class T, list_hook T::* Hook, bool is_const>
+class reverse_intrusive_list_iterator
+{
+    public:
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename choose<is_const, const T*, T*>::type pointer;
+        typedef typename choose<is_const, const T&, T&>::type reference;
+        typedef std::bidirectional_iterator_tag iterator_category;
+
+    private:
+        typedef reverse_intrusive_list_iterator<value_type, Hook, is_const> self_type;
+        typedef typename choose<is_const, const list_node_base*, list_node_base*>::type node_pointer;
+        typedef typename choose<is_const, const list_hook*, list_hook*>::type hook_pointer;
+        typedef member_hook<value_type, list_hook, Hook> hook_traits;
+
+    public:
+        /* CONSTRUCTORS */
+        reverse_intrusive_list_iterator (node_pointer node = NULL)
+            : _node(node)
+        {
+        }
+
+        reverse_intrusive_list_iterator (const reverse_intrusive_list_iterator<value_type, Hook, false>& other)
+            : _node(other.get_node())
+        {
+        }
+
+        /* OPERATORS */
+        reverse_intrusive_list_iterator& operator= (const self_type& other)
+        {
+            if (this != &other)
+                _node = other._node;
+            return *this;
+        }
+
+        friend bool operator== (const self_type& rhs, const self_type& lhs) { return rhs._node == lhs._node; }
+        friend bool operator!= (const self_type& rhs, const self_type& lhs) { return rhs._node != lhs._node; }
+
+        reference operator* (void) { return *hook_traits::to_value(static_cast<hook_pointer>(_node)); }
+        pointer operator-> (void) { return hook_traits::to_value(static_cast<hook_pointer>(_node)); }
+
+        self_type& operator++ (void)
+        {
+            _node = _node->prev;
+            return *this;
+        }
+
+        self_type operator++ (int)
+        {
+            self_type tmp = *this;
+            _node = _node->prev;
+            return tmp;
+        }
+
+        self_type& operator-- (void)
+        {
+            _node = _node->next;
+            return *this;
+        }
+
+        self_type operator-- (int)
+        {
+            self_type tmp = *this;
+            _node = _node->next;
+            return tmp;
+        }
+
+        /* GETTER */
+        node_pointer get_node (void) const { return _node; }
+
+    private:
+        node_pointer _node;
+
+}; // CLASS REVERSE_INTRUSIVE_LIST_ITERATOR
+
+} // NAMESPACE FT
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "../list/list_node.hpp"
+
+#include <cstddef> // NULL
+
+namespace ft {
+
+// the links an element embeds to be put in an intrusive_list, the hook
+// is in one list at most & an element is in several lists at once through
+// several hooks. a copy starts unlinked & an assignment keeps the links,
+// the list never lets an element be linked twice by copying it
+struct list_hook : list_node_base
+{
+        list_hook (void)
+            : list_node_base()
+        {
+        }
+
+        list_hook (const list_hook&)
+            : list_node_base()
+        {
+        }
+
+        list_hook& operator= (const list_hook&) { return *this; }
+
+        bool is_linked (void) const { return next != NULL; }
+
+}; // STRUCT LIST_HOOK
+
+} // NAMESPACE FT
@@ -6,6 +6,7 @@
 
 #include <cstddef> // NULL, std::ptrdiff_t
 #include <cassert> // assert
+#include <climits> // CHAR_BIT
 
 #include <memory> // std::allocator
 #include <limits> // std::numeric_limits
@@ -34,43 +35,50 @@ class list
     private:
         typedef list_node<value_type> node;
         typedef node* node_pointer;
+        typedef list_node_base* base_pointer;
         typedef typename Alloc::template rebind<node>::other node_allocator;
 
     public:
         /* CONSTRUCTORS */
         explicit list (const allocator_type& alloc = allocator_type())
-            : _size(0), _head(new_node()), _tail(new_node()), _alloc(alloc)
+            : _alloc(alloc), _size(0)
         {
-            _head->next = _tail;
-            _tail->prev = _head;
+            initialize_sentinel();
         }
 
         explicit list (size_t n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
-            : _size(0), _head(new_node()), _tail(new_node()), _alloc(alloc)
+            : _alloc(alloc), _size(0)
         {
-            _head->next = _tail;
-            _tail->prev = _head;
+            initialize_sentinel();
             assign(n, val);
         }
 
         template <class InputIterator>
         list (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
-            : _size(0), _head(new_node()), _tail(new_node()), _alloc(alloc)
+            : _alloc(alloc), _size(0)
         {
-            _head->next = _tail;
-            _tail->prev = _head;
+            initialize_sentinel();
             assign(first, last);
         }
 
         list (const list& x)
-            : _size(0), _head(new_node()), _tail(new_node()), _alloc(x._alloc)
+            : _alloc(x._alloc), _size(0)
         {
-            _head->next = _tail;
-            _tail->prev = _head;
+            initialize_sentinel();
             *this = x;
         }
 
+#ifdef FT_HAS_CXX11
+        // x is left empty
+        list (list&& x)
+            : _alloc(x._alloc), _size(0)
+        {
+            initialize_sentinel();
+            swap(x);
+        }
+#endif
+
         /* OPERATORS */
         list& operator= (const list& x)
         {
@@ -79,6 +87,17 @@ class list
             return *this;
         }
 
+#ifdef FT_HAS_CXX11
+        list& operator= (list&& x)
+        {
+            if (this != &x) {
+                clear();
+                swap(x);
+            }
+            return *this;
+        }
+#endif
+
         friend bool operator== (const list<T, Alloc>& lhs, const list<T, Alloc>& rhs)
         {
             if (lhs._size != rhs._size)
@@ -120,19 +139,18 @@ class list
         ~list()
         {
             clear();
-            delete_node(_head);
-            delete_node(_tail);
         }
 
         /* ITERATORS */
-        iterator begin() { return iterator(_head->next); }
-        const_iterator begin() const { return const_iterator(_head->next); }
-        iterator end() { return iterator(_tail); }
-        const_iterator end() const { return const_iterator(_tail); }
-        reverse_iterator rbegin() { return reverse_iterator(_tail->prev); }
-        const_reverse_iterator rbegin() const { return const_reverse_iterator(_tail->prev); }
-        reverse_iterator rend() { return reverse_iterator(_head); }
-        const_reverse_iterator rend() const { return const_reverse_iterator(_head); }
+        // the sentinel ends the ring in both directions
+        iterator begin() { return iterator(_sentinel.next); }
+        const_iterator begin() const { return const_iterator(_sentinel.next); }
+        iterator end() { return iterator(&_sentinel); }
+        const_iterator end() const { return const_iterator(&_sentinel); }
+        reverse_iterator rbegin() { return reverse_iterator(_sentinel.prev); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(_sentinel.prev); }
+        reverse_iterator rend() { return reverse_iterator(&_sentinel); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(&_sentinel); }
 
         /* CAPACITY */
         bool empty() const { return _size == 0; }
@@ -140,10 +158,10 @@ class list
         size_type max_size() const { return _alloc.max_size(); }
 
         /* ELEMENT ACCESS */
-        reference front (void) { return _head->next->content; }
-        const_reference front (void) const { return _head->next->content; }
-        reference back (void) { return _tail->prev->content; }
-        const_reference back (void) const { return _tail->prev->content; }
+        reference front (void) { return value_of(_sentinel.next); }
+        const_reference front (void) const { return value_of(_sentinel.next); }
+        reference back (void) { return value_of(_sentinel.prev); }
+        const_reference back (void) const { return value_of(_sentinel.prev); }
 
         /* MODIFIERS */
         template <class InputIterator>
@@ -164,53 +182,60 @@ class list
 
         void push_front (const value_type& val)
         {
-            node_pointer node = new_node(val);
-            node->next = _head->next;
-            node->prev = _head;
-            _head->next->prev = node;
-            _head->next = node;
+            list_link(new_node(val), _sentinel.next);
             ++_size;
         }
 
         void pop_front (void)
         {
-            node_pointer tmp = _head->next;
-            _head->next->next->prev = _head;
-            _head->next = _head->next->next;
+            base_pointer tmp = _sentinel.next;
+            list_unlink(tmp);
             --_size;
             delete_node(tmp);
         }
 
         void push_back (const value_type& val)
         {
-            node_pointer node = new_node(val);
-            node->next = _tail;
-            node->prev = _tail->prev;
-            _tail->prev->next = node;
-            _tail->prev = node;
+            list_link(new_node(val), &_sentinel);
             ++_size;
         }
 
         void pop_back (void)
         {
-            node_pointer tmp = _tail->prev;
-            _tail->prev->prev->next = _tail;
-            _tail->prev = _tail->prev->prev;
+            base_pointer tmp = _sentinel.prev;
+            list_unlink(tmp);
             --_size;
             delete_node(tmp);
         }
 
         iterator insert (iterator position, const value_type& val)
         {
-            node_pointer to_insert = new_node(val);
-            to_insert->prev = position.get_prev();
-            to_insert->next = position.get_node();
-            position.get_prev()->next = to_insert;
-            position.get_node()->prev = to_insert;
+            list_link(new_node(val), position.get_node());
             ++_size;
             return --position;
         }
 
+#ifdef FT_HAS_CXX11
+        void push_front (value_type&& val) { emplace(begin(), std::move(val)); }
+        void push_back (value_type&& val) { emplace(end(), std::move(val)); }
+        iterator insert (iterator position, value_type&& val) { return emplace(position, std::move(val)); }
+
+        template <class... Args>
+        void emplace_front (Args&&... args) { emplace(begin(), std::forward<Args>(args)...); }
+
+        template <class... Args>
+        void emplace_back (Args&&... args) { emplace(end(), std::forward<Args>(args)...); }
+
+        template <class... Args>
+        iterator emplace (iterator position, Args&&... args)
+        {
+            node_pointer to_insert = new_node(in_place_t(), std::forward<Args>(args)...);
+            list_link(to_insert, position.get_node());
+            ++_size;
+            return iterator(to_insert);
+        }
+#endif
+
         void insert (iterator position, size_type n, const value_type& val)
         {
             for (size_type i = 0; i < n; ++i)
@@ -229,13 +254,19 @@ class list
         {
             iterator next = position;
             ++next;
-            return erase(position, next);
+            return erase(position, next, 1);
         }
 
         iterator erase (iterator first, iterator last)
         {
-            difference_type i = std::distance(first, last);
-            _size -= i;
+            return erase(first, last, std::distance(first, last));
+        }
+
+        // n has to be the distance from first to last, a caller who knows
+        // it skips the walk over the range
+        iterator erase (iterator first, iterator last, size_type n)
+        {
+            _size -= n;
 
             first.get_prev()->next = last.get_node();
             last.get_node()->prev = first.get_prev();
@@ -246,12 +277,16 @@ class list
             return last;
         }
 
+        // the sentinels stay in place, only the first & last nodes are
+        // relinked to their new sentinel
         void swap (list& x)
         {
             ft::swap(_alloc, x._alloc);
             ft::swap(_size, x._size);
-            ft::swap(_head, x._head);
-            ft::swap(_tail, x._tail);
+            ft::swap(_sentinel.next, x._sentinel.next);
+            ft::swap(_sentinel.prev, x._sentinel.prev);
+            relink_sentinel();
+            x.relink_sentinel();
         }
 
         void resize (size_type n, value_type val = value_type())
@@ -268,39 +303,40 @@ class list
 
         void clear (void)
         {
-            erase(begin(), end());
-            _size = 0;
+            erase(begin(), end(), _size);
         }
 
         /* OPERATIONS */
         void splice (iterator position, list& x)
         {
-            splice(position, x, x.begin(), x.end());
+            splice(position, x, x.begin(), x.end(), x._size);
         }
 
         void splice (iterator position, list& x, iterator i)
         {
             iterator next = i;
             ++next;
-            splice(position, x, i, next);
+            splice(position, x, i, next, 1);
         }
 
+        // the nodes stay in the same list when x is *this, their count is
+        // only needed otherwise
         void splice (iterator position, list& x, iterator first, iterator last)
+        {
+            splice(position, x, first, last, &x == this ? 0 : std::distance(first, last));
+        }
+
+        // n has to be the distance from first to last, a caller who knows
+        // it skips the walk over the range
+        void splice (iterator position, list& x, iterator first, iterator last, size_type n)
         {
             if (first == last)
                 return ;
-
-            difference_type i = std::distance(first, last);
-            _size += i;
-            x._size -= i;
-
-            node_pointer tmp = last.get_prev();
-            first.get_prev()->next = last.get_node();
-            last.get_node()->prev = first.get_prev();
-            position.get_prev()->next = first.get_node();
-            first.get_node()->prev = position.get_prev();
-            tmp->next = position.get_node();
-            position.get_node()->prev = tmp;
+            if (&x != this) {
+                _size += n;
+                x._size -= n;
+            }
+            list_transfer(position.get_node(), first.get_node(), last.get_node());
         }
 
         void remove (const value_type& val)
@@ -351,34 +387,33 @@ class list
             merge(x, std::less<value_type>());
         }
 
+        // the nodes of x are relinked into *this in a single pass, a run of
+        // them which goes before the same node is moved at once
         template <class Compare>
         void merge (list& x, Compare comp)
         {
-            if (x._size == 0)
+            if (&x == this || x._size == 0)
                 return ;
 
-            list<value_type> result;
-            while (_size != 0 && x._size != 0) {
-                if (comp(*x.begin(), *begin()))
-                    result.splice(result.end(), x, x.begin());
+            base_pointer first1 = _sentinel.next;
+            base_pointer first2 = x._sentinel.next;
+            base_pointer last1 = &_sentinel;
+            base_pointer last2 = &x._sentinel;
+            while (first1 != last1 && first2 != last2) {
+                if (comp(value_of(first2), value_of(first1))) {
+                    base_pointer next = first2->next;
+                    while (next != last2 && comp(value_of(next), value_of(first1)))
+                        next = next->next;
+                    list_transfer(first1, first2, next);
+                    first2 = next;
+                }
                 else
-                    result.splice(result.end(), *this, begin());
-            }
-            if (_size != 0) {
-                assert(x._size == 0);
-                result.splice(result.end(), *this);
-            } else if (x._size != 0) {
-                result.splice(result.end(), x);
+                    first1 = first1->next;
             }
-            _size = result._size;
-
-            _head->next = result._head->next;
-            _head->next->prev = _head;
-            _tail->prev = result._tail->prev;
-            _tail->prev->next = _tail;
-
-            result._head->next = result._tail;
-            result._tail->prev = result._head;
+            if (first2 != last2)
+                list_transfer(last1, first2, last2);
+            _size += x._size;
+            x._size = 0;
         }
 
         void sort (void)
@@ -386,53 +421,147 @@ class list
             sort(std::less<value_type>());
         }
 
+        // bottom-up merge sort relinking the nodes in place, nothing is
+        // allocated. bucket i holds a sorted run of 2^i nodes or nothing,
+        // each node is carried up the buckets like a binary counter & the
+        // runs left in the buckets are merged at the end, the runs of the
+        // higher buckets holding the earlier nodes keeps the sort stable. if
+        // comp throws the list is left in its original order
         template <class Compare>
         void sort (Compare comp)
         {
             if (_size < 2)
                 return ;
 
-            iterator it = begin();
-            std::advance(it, _size / 2);
-
-            list<value_type> left;
-            list<value_type> right;
-            left.splice(left.begin(), *this, begin(), it);
-            right.splice(right.begin(), *this, begin(), end());
+            // the nodes are chained through next only while sorting
+            sort_guard guard = { *this, false };
+            base_pointer buckets[sizeof(size_type) * CHAR_BIT] = { };
+            base_pointer node = _sentinel.next;
+            _sentinel.prev->next = NULL;
+            while (node) {
+                base_pointer carry = node;
+                node = node->next;
+                carry->next = NULL;
+                size_type i = 0;
+                for (; buckets[i]; ++i) {
+                    carry = merge_runs(buckets[i], carry, comp);
+                    buckets[i] = NULL;
+                }
+                buckets[i] = carry;
+            }
+            base_pointer run = NULL;
+            for (size_type i = 0; i < sizeof(buckets) / sizeof(*buckets); ++i) {
+                if (buckets[i])
+                    run = merge_runs(buckets[i], run, comp);
+            }
 
-            left.sort(comp);
-            right.sort(comp);
-            left.merge(right, comp);
-            merge(left, comp);
+            // restore the prev links
+            guard.done = true;
+            base_pointer prev = &_sentinel;
+            for (; run; prev = run, run = run->next) {
+                prev->next = run;
+                run->prev = prev;
+            }
+            prev->next = &_sentinel;
+            _sentinel.prev = prev;
         }
 
         void reverse (void)
         {
-            if (_size < 2)
-                return ;
-            iterator pos = begin();
-            for (size_type i = 0; i < _size - 1; ++i)
-                splice(pos, *this, --end());
+            list_reverse(&_sentinel);
         }
 
     private:
-        size_type _size;
-        node_pointer _head;
-        node_pointer _tail;
         node_allocator _alloc;
+        size_type _size;
+        // holds no value, it is not allocated
+        list_node_base _sentinel;
+
+        static value_type& value_of (base_pointer p) { return static_cast<node_pointer>(p)->content; }
+
+        /* SENTINEL */
+        void initialize_sentinel (void)
+        {
+            _sentinel.next = &_sentinel;
+            _sentinel.prev = &_sentinel;
+        }
+
+        // points the first & last nodes back to the sentinel
+        void relink_sentinel (void)
+        {
+            if (_size == 0) {
+                initialize_sentinel();
+            } else {
+                _sentinel.next->prev = &_sentinel;
+                _sentinel.prev->next = &_sentinel;
+            }
+        }
+
+        /* SORT */
+        // the prev links keep the original order until the sort is done,
+        // the next links are rebuilt from them when comp throws
+        struct sort_guard
+        {
+            list& lst;
+            bool done;
+
+            ~sort_guard()
+            {
+                if (done)
+                    return ;
+                base_pointer node = &lst._sentinel;
+                do {
+                    node->prev->next = node;
+                    node = node->prev;
+                } while (node != &lst._sentinel);
+            }
+        };
+
+        // merges two null-terminated runs chained through next, the nodes of
+        // later only go first when they compare less, so equal nodes of
+        // earlier stay ahead
+        template <class Compare>
+        static base_pointer merge_runs (base_pointer earlier, base_pointer later, Compare& comp)
+        {
+            list_node_base head;
+            base_pointer tail = &head;
+            while (earlier && later) {
+                if (comp(value_of(later), value_of(earlier))) {
+                    tail->next = later;
+                    later = later->next;
+                } else {
+                    tail->next = earlier;
+                    earlier = earlier->next;
+                }
+                tail = tail->next;
+            }
+            tail->next = earlier ? earlier : later;
+            return head.next;
+        }
 
         /* MEMORY MANAGEMENT */
-        node_pointer new_node (const value_type& val = value_type())
+        node_pointer new_node (const value_type& val)
         {
             node_pointer p = _alloc.allocate(1);
             _alloc.construct(p, val); // implicitly calls list_node constructor to create tmp node
             return p;
         }
 
-        void delete_node (node_pointer p)
+#ifdef FT_HAS_CXX11
+        template <class... Args>
+        node_pointer new_node (in_place_t, Args&&... args)
+        {
+            node_pointer p = _alloc.allocate(1);
+            _alloc.construct(p, in_place_t(), std::forward<Args>(args)...);
+            return p;
+        }
+#endif
+
+        void delete_node (base_pointer p)
         {
-            _alloc.destroy(p);
-            _alloc.deallocate(p, 1);
+            node_pointer node = static_cast<node_pointer>(p);
+            _alloc.destroy(node);
+            _alloc.deallocate(node, 1);
         }
 
 }; // CLASS LIST
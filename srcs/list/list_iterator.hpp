@@ -21,7 +21,8 @@ class list_iterator
 
     private:
         typedef list_iterator<value_type, is_const> self_type;
-        typedef typename choose<is_const, const list_node<value_type>*, list_node<value_type>*>::type node_pointer;
+        typedef typename choose<is_const, const list_node_base*, list_node_base*>::type node_pointer;
+        typedef typename choose<is_const, const list_node<value_type>*, list_node<value_type>*>::type value_node_pointer;
 
     public:
         /* CONSTRUCTORS */
@@ -46,8 +47,8 @@ class list_iterator
         friend bool operator== (const self_type& rhs, const self_type& lhs) { return rhs._node == lhs._node; }
         friend bool operator!= (const self_type& rhs, const self_type& lhs) { return rhs._node != lhs._node; }
 
-        reference operator* (void) { return _node->content; }
-        pointer operator-> (void) { return &_node->content; }
+        reference operator* (void) { return static_cast<value_node_pointer>(_node)->content; }
+        pointer operator-> (void) { return &static_cast<value_node_pointer>(_node)->content; }
 
         self_type& operator++ (void)
         {
@@ -97,7 +98,8 @@ class reverse_list_iterator
 
     private:
         typedef reverse_list_iterator<value_type, is_const> self_type;
-        typedef typename choose<is_const, const list_node<value_type>*, list_node<value_type>*>::type node_pointer;
+        typedef typename choose<is_const, const list_node_base*, list_node_base*>::type node_pointer;
+        typedef typename choose<is_const, const list_node<value_type>*, list_node<value_type>*>::type value_node_pointer;
 
     public:
         /* CONSTRUCTORS */
@@ -122,8 +124,8 @@ class reverse_list_iterator
         friend bool operator== (const self_type& rhs, const self_type& lhs) { return rhs._node == lhs._node; }
         friend bool operator!= (const self_type& rhs, const self_type& lhs) { return !(rhs == lhs); }
 
-        reference operator* (void) { return _node->content; }
-        pointer operator-> (void) { return &_node->content; }
+        reference operator* (void) { return static_cast<value_node_pointer>(_node)->content; }
+        pointer operator-> (void) { return &static_cast<value_node_pointer>(_node)->content; }
 
         self_type& operator++ (void)
         {
@@ -1,21 +1,87 @@
 #pragma once
 
+#include "../utils/utils.hpp" // in_place_t, ft::swap
+
 #include <cstddef> // NULL
 
 namespace ft {
 
+// the links of a node without its content, the list embeds one as its
+// sentinel: the nodes form a ring through it, it is both the end & the
+// reverse end of the list
+struct list_node_base
+{
+        list_node_base* prev;
+        list_node_base* next;
+
+        list_node_base (void)
+            : prev(NULL), next(NULL)
+        {
+        }
+
+}; // STRUCT LIST_NODE_BASE
+
 template <class T>
-struct list_node
+struct list_node : list_node_base
 {
         T content;
-        list_node* prev;
-        list_node* next;
 
         list_node (const T& cont = T())
-            : content(cont), prev(NULL), next(NULL)
+            : list_node_base(), content(cont)
+        {
+        }
+
+#ifdef FT_HAS_CXX11
+        template <class... Args>
+        list_node (in_place_t, Args&&... args)
+            : list_node_base(), content(std::forward<Args>(args)...)
         {
         }
+#endif
 
 }; // STRUCT LIST_NODE
 
+/* RELINKING */
+// the functions below only rewrite links so that the lists owning their
+// nodes & the intrusive ones share them
+inline void list_link (list_node_base* node, list_node_base* position)
+{
+    node->prev = position->prev;
+    node->next = position;
+    position->prev->next = node;
+    position->prev = node;
+}
+
+inline void list_unlink (list_node_base* node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+}
+
+// moves [first, last) before position, the range can belong to another
+// ring & may only contain position as its first node, which leaves it
+// in place
+inline void list_transfer (list_node_base* position, list_node_base* first, list_node_base* last)
+{
+    if (position == first || position == last)
+        return ;
+    list_node_base* tmp = last->prev;
+    first->prev->next = last;
+    last->prev = first->prev;
+    position->prev->next = first;
+    first->prev = position->prev;
+    tmp->next = position;
+    position->prev = tmp;
+}
+
+// every node of the ring swaps its links, the sentinel included
+inline void list_reverse (list_node_base* sentinel)
+{
+    list_node_base* node = sentinel;
+    do {
+        ft::swap(node->next, node->prev);
+        node = node->prev;
+    } while (node != sentinel);
+}
+
 } // NAMESPACE FT
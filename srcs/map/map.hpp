@@ -17,7 +17,7 @@ template < class Key,
            class Compare = std::less<Key>,
            class Alloc = std::allocator<std::pair<const Key, T> >
            >
-class map : public avl_tree<std::pair<const Key, T>, Compare, Alloc>
+class map : public avl_tree<std::pair<const Key, T>, Compare, Alloc, ft::select_first<std::pair<const Key, T> > >
 {
     public:
         typedef Key key_type;
@@ -54,30 +54,46 @@ class map : public avl_tree<std::pair<const Key, T>, Compare, Alloc>
         };
 
     private:
-        typedef avl_tree<value_type, key_compare, allocator_type> Base;
+        typedef avl_tree<value_type, key_compare, allocator_type, ft::select_first<value_type> > Base;
         typedef avl_node<value_type> node;
         typedef node* node_pointer;
+        typedef avl_node_base* base_pointer;
 
     public:
         /* CONSTRUCTORS */
         explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
-            : _comp(comp), _alloc(alloc)
+            : Base(comp, alloc)
         {
         }
 
         template <class InputIterator>
         map (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(),
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
-            : _comp(comp), _alloc(alloc)
+            : Base(comp, alloc)
         {
             insert(first, last);
         }
 
+        // the caller guarantees that [first, last) is sorted w/o duplicates
+        template <class InputIterator>
+        static map from_sorted (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+        {
+            map ret (comp, alloc);
+            ret.aux_build_sorted(first, last, false, false);
+            return ret;
+        }
+
         map (const map& x)
-            : _comp(x._comp), _alloc(x._alloc)
+            : Base(x)
+        {
+        }
+
+#ifdef FT_HAS_CXX11
+        map (map&& x)
+            : Base(std::move(x))
         {
-            *this = x;
         }
+#endif
 
         /* DESTRUCTOR */
         ~map()
@@ -88,12 +104,20 @@ class map : public avl_tree<std::pair<const Key, T>, Compare, Alloc>
         map& operator= (const map& x)
         {
             if (this != &x) {
-                _comp = x._comp;
-                Base::clear();
-                insert(x.begin(), x.end());
+                Base::operator=(x);
+            }
+            return *this;
+        }
+
+#ifdef FT_HAS_CXX11
+        map& operator= (map&& x)
+        {
+            if (this != &x) {
+                Base::operator=(std::move(x));
             }
             return *this;
         }
+#endif
 
         mapped_type& operator[] (const key_type& k)
         {
@@ -113,10 +137,10 @@ class map : public avl_tree<std::pair<const Key, T>, Compare, Alloc>
 
         iterator insert (iterator position, const value_type& val)
         {
-            if (position != Base::end() && _comp(position->first, val.first)) {
+            if (position != Base::end() && Base::_comp(position->first, val.first)) {
                 iterator next = position;
                 ++next;
-                if (next == Base::end() || _comp(val.first, next->first)) {
+                if (next == Base::end() || Base::_comp(val.first, next->first)) {
                     Base::unset_bounds();
                     aux_insert(position.get_node()->parent, position.get_node(), val);
                     // do not need to check if node was inserted since
@@ -133,33 +157,28 @@ class map : public avl_tree<std::pair<const Key, T>, Compare, Alloc>
         void insert (InputIterator first, InputIterator last,
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
         {
+            if (Base::empty())
+                first = Base::aux_build_sorted(first, last, false, true);
             for (; first != last; ++first)
                 insert(*first);
         }
 
+#ifdef FT_HAS_CXX11
+        std::pair<iterator, bool> insert (value_type&& val) { return Base::emplace(std::move(val)); }
+        iterator insert (iterator position, value_type&& val) { return Base::emplace_hint(position, std::move(val)); }
+#endif
+
         void erase (iterator position)
         {
-            --Base::_size;
-            Base::unset_bounds();
-            node_pointer node = position.get_node();
-            node_pointer tmp;
-            if (!node->left && !node->right)
-                tmp = Base::aux_erase_no_child_node(node);
-            else if ((!node->left && node->right) || (node->left && !node->right))
-                tmp = Base::aux_erase_one_child_node(node);
-            else
-                tmp = Base::aux_erase_two_child_node(node);
-            Base::recompute_heights(tmp);
-            Base::rebalance(tmp);
-            Base::set_bounds();
+            Base::erase(position);
         }
 
         size_type erase (const key_type& k)
         {
             size_type old_size = Base::_size;
-            iterator it = find(k);
+            iterator it = Base::find(k);
             if (it != Base::end())
-                erase(find(k));
+                erase(it);
             return old_size - Base::_size;
         }
 
@@ -172,106 +191,11 @@ class map : public avl_tree<std::pair<const Key, T>, Compare, Alloc>
         }
 
         /* OBSERVERS */
-        key_compare key_comp (void) const { return _comp; }
-        value_compare value_comp (void) const { return value_compare(_comp); }
-
-        /* OPERATIONS */
-        size_type count (const key_type& k) const
-        {
-            if (find(k) != Base::end())
-                return 1;
-            return 0;
-        }
-
-        iterator find (const key_type& k)
-        {
-            node_pointer node = Base::_root;
-            while (node && node != Base::_begin && node != Base::_end) {
-                if (_comp(node->content.first, k))
-                    node = node->right;
-                else if (_comp(k, node->content.first))
-                    node = node->left;
-                else
-                    return iterator(node);
-            }
-            return Base::end();
-        }
-
-        const_iterator find (const key_type& k) const
-        {
-            node_pointer node = Base::_root;
-            while (node && node != Base::_begin && node != Base::_end) {
-                if (_comp(node->content.first, k))
-                    node = node->right;
-                else if (_comp(k, node->content.first))
-                    node = node->left;
-                else
-                    return const_iterator(node);
-            }
-            return Base::end();
-        }
-
-        std::pair<iterator, iterator> equal_range (const key_type& k)
-        {
-            iterator low = lower_bound(k);
-            iterator up = upper_bound(k);
-            return std::make_pair(low, up);
-        }
-
-        std::pair<const_iterator, const_iterator> equal_range (const key_type& k) const
-        {
-            const_iterator low = lower_bound(k);
-            const_iterator up = upper_bound(k);
-            return std::make_pair(low, up);
-        }
-
-        // lower_bound returns iterator to first element that is not less than k
-        // upper_bound returns iterator to first element that is greater than k
-        iterator lower_bound (const key_type& k)
-        {
-            iterator ite = Base::end();
-            for (iterator it = Base::begin(); it != ite; ++it) {
-                if (!_comp(it->first, k))
-                    return it;
-            }
-            return ite;
-        }
-
-        const_iterator lower_bound (const key_type& k) const
-        {
-            const_iterator ite = Base::end();
-            for (const_iterator it = Base::begin(); it != ite; ++it) {
-                if (!_comp(it->first, k))
-                    return it;
-            }
-            return ite;
-        }
-
-        iterator upper_bound (const key_type& k)
-        {
-            iterator ite = Base::end();
-            for (iterator it = Base::begin(); it != ite; ++it) {
-                if (_comp(k, it->first))
-                    return it;
-            }
-            return ite;
-        }
-
-        const_iterator upper_bound (const key_type& k) const
-        {
-            const_iterator ite = Base::end();
-            for (const_iterator it = Base::begin(); it != ite; ++it) {
-                if (_comp(k, it->first))
-                    return it;
-            }
-            return ite;
-        }
+        key_compare key_comp (void) const { return Base::_comp; }
+        value_compare value_comp (void) const { return value_compare(Base::_comp); }
 
     private:
-        key_compare _comp;
-        allocator_type _alloc;
-
-        node_pointer aux_insert (node_pointer parent, node_pointer node, const value_type& val)
+        base_pointer aux_insert (base_pointer parent, base_pointer node, const value_type& val)
         {
             // if we're at a leaf insert key/val pair
             // else if key goes into the left subtree
@@ -284,9 +208,9 @@ class map : public avl_tree<std::pair<const Key, T>, Compare, Alloc>
                 Base::_added_node = true;
                 Base::_added_node_ptr = node;
                 ++Base::_size;
-            } else if (_comp(val.first, node->content.first)) {
+            } else if (Base::_comp(val.first, Base::value_of(node).first)) {
                 node->left = aux_insert(node, node->left, val);
-            } else if (_comp(node->content.first, val.first)) {
+            } else if (Base::_comp(Base::value_of(node).first, val.first)) {
                 node->right = aux_insert(node, node->right, val);
             } else {
                 Base::_added_node = false;
@@ -39,27 +39,43 @@ class multiset : public avl_tree<T, Compare, Alloc>
         typedef avl_tree<value_type, key_compare, allocator_type> Base;
         typedef avl_node<value_type> node;
         typedef node* node_pointer;
+        typedef avl_node_base* base_pointer;
 
     public:
         /* CONSTRUCTORS */
         explicit multiset (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
-            : _comp(comp), _alloc(alloc)
+            : Base(comp, alloc)
         {
         }
 
         template <class InputIterator>
         multiset (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(),
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
-            : _comp(comp), _alloc(alloc)
+            : Base(comp, alloc)
         {
             insert(first, last);
         }
 
+        // the caller guarantees that [first, last) is sorted
+        template <class InputIterator>
+        static multiset from_sorted (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+        {
+            multiset ret (comp, alloc);
+            ret.aux_build_sorted(first, last, true, false);
+            return ret;
+        }
+
         multiset (const multiset& x)
-            : _comp(x._comp), _alloc(x._alloc)
+            : Base(x)
+        {
+        }
+
+#ifdef FT_HAS_CXX11
+        multiset (multiset&& x)
+            : Base(std::move(x))
         {
-            *this = x;
         }
+#endif
 
         /* DESTRUCTOR */
         ~multiset()
@@ -70,13 +86,21 @@ class multiset : public avl_tree<T, Compare, Alloc>
         multiset& operator= (const multiset& x)
         {
             if (this != &x) {
-                _comp = x._comp;
-                Base::clear();
-                insert(x.begin(), x.end());
+                Base::operator=(x);
             }
             return *this;
         }
 
+#ifdef FT_HAS_CXX11
+        multiset& operator= (multiset&& x)
+        {
+            if (this != &x) {
+                Base::operator=(std::move(x));
+            }
+            return *this;
+        }
+#endif
+
         /* MODIFIERS */
         iterator insert (const value_type& val)
         {
@@ -89,12 +113,12 @@ class multiset : public avl_tree<T, Compare, Alloc>
 
         iterator insert (iterator position, const value_type& val)
         {
-            if (position != Base::end() && _comp(*position, val)) {
+            if (position != Base::end() && Base::_comp(*position, val)) {
                 iterator next = position;
                 ++next;
-                if (next == Base::end() || _comp(val, *next)) {
+                if (next == Base::end() || Base::_comp(val, *next)) {
                     Base::unset_bounds();
-                    node_pointer position_ptr = position.get_node();
+                    base_pointer position_ptr = position.get_node();
                     aux_insert(position_ptr->parent, position_ptr, val);
                     Base::rebalance(Base::_added_node_ptr);
                     Base::set_bounds();
@@ -108,33 +132,41 @@ class multiset : public avl_tree<T, Compare, Alloc>
         void insert (InputIterator first, InputIterator last,
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
         {
+            if (Base::empty())
+                first = Base::aux_build_sorted(first, last, true, true);
             for (; first != last; ++first)
                 insert(*first);
         }
 
+#ifdef FT_HAS_CXX11
+        iterator insert (value_type&& val) { return emplace(std::move(val)); }
+        iterator insert (iterator position, value_type&& val) { return emplace_hint(position, std::move(val)); }
+
+        template <class... Args>
+        iterator emplace (Args&&... args)
+        {
+            return Base::aux_link(Base::_root, Base::new_node(in_place_t(), std::forward<Args>(args)...), true).first;
+        }
+
+        template <class... Args>
+        iterator emplace_hint (iterator position, Args&&... args)
+        {
+            node_pointer node = Base::new_node(in_place_t(), std::forward<Args>(args)...);
+            return Base::aux_link(Base::aux_hint(position, node), node, true).first;
+        }
+#endif
+
         void erase (iterator position)
         {
             if (position == Base::end())
                 return ;
-            --Base::_size;
-            Base::unset_bounds();
-            node_pointer node = position.get_node();
-            node_pointer tmp;
-            if (!node->left && !node->right)
-                tmp = Base::aux_erase_no_child_node(node);
-            else if ((!node->left && node->right) || (node->left && !node->right))
-                tmp = Base::aux_erase_one_child_node(node);
-            else
-                tmp = Base::aux_erase_two_child_node(node);
-            Base::recompute_heights(tmp);
-            Base::rebalance(tmp);
-            Base::set_bounds();
+            Base::erase(position);
         }
 
         size_type erase (const key_type& k)
         {
             size_type old_size = Base::_size;
-            std::pair<iterator, iterator> eq = equal_range(k);
+            std::pair<iterator, iterator> eq = Base::equal_range(k);
             erase(eq.first, eq.second);
             return old_size - Base::_size;
         }
@@ -148,114 +180,27 @@ class multiset : public avl_tree<T, Compare, Alloc>
         }
 
         /* OBSERVERS */
-        key_compare key_comp (void) const { return _comp; }
-        value_compare value_comp (void) const { return value_compare(_comp); }
+        key_compare key_comp (void) const { return Base::_comp; }
+        value_compare value_comp (void) const { return value_compare(Base::_comp); }
 
         /* OPERATIONS */
         size_type count (const key_type& k) const
         {
-            std::pair<const_iterator, const_iterator> eq = equal_range(k);
-            return std::distance(eq.first, eq.second);
-        }
-
-        iterator find (const key_type& k)
-        {
-            node_pointer node = Base::_root;
-            while (node && node != Base::_begin && node != Base::_end) {
-                if (_comp(node->content, k))
-                    node = node->right;
-                else if (_comp(k, node->content))
-                    node = node->left;
-                else
-                    return iterator(node);
-            }
-            return Base::end();
-        }
-
-        const_iterator find (const key_type& k) const
-        {
-            node_pointer node = Base::_root;
-            while (node && node != Base::_begin && node != Base::_end) {
-                if (_comp(node->content, k))
-                    node = node->right;
-                else if (_comp(k, node->content))
-                    node = node->left;
-                else
-                    return const_iterator(node);
-            }
-            return Base::end();
-        }
-
-        std::pair<iterator, iterator> equal_range (const key_type& k)
-        {
-            iterator low = lower_bound(k);
-            iterator up = upper_bound(k);
-            return std::make_pair(low, up);
-        }
-
-        std::pair<const_iterator, const_iterator> equal_range (const key_type& k) const
-        {
-            const_iterator low = lower_bound(k);
-            const_iterator up = upper_bound(k);
-            return std::make_pair(low, up);
-        }
-
-        // lower_bound returns iterator to first element that is not less than k
-        // upper_bound returns iterator to first element that is greater than k
-        iterator lower_bound (const key_type& k)
-        {
-            iterator ite = Base::end();
-            for (iterator it = Base::begin(); it != ite; ++it) {
-                if (!_comp(*it, k))
-                    return it;
-            }
-            return ite;
-        }
-
-        const_iterator lower_bound (const key_type& k) const
-        {
-            const_iterator ite = Base::end();
-            for (const_iterator it = Base::begin(); it != ite; ++it) {
-                if (!_comp(*it, k))
-                    return it;
-            }
-            return ite;
-        }
-
-        iterator upper_bound (const key_type& k)
-        {
-            iterator ite = Base::end();
-            for (iterator it = Base::begin(); it != ite; ++it) {
-                if (_comp(k, *it))
-                    return it;
-            }
-            return ite;
-        }
-
-        const_iterator upper_bound (const key_type& k) const
-        {
-            const_iterator ite = Base::end();
-            for (const_iterator it = Base::begin(); it != ite; ++it) {
-                if (_comp(k, *it))
-                    return it;
-            }
-            return ite;
+            std::pair<const_iterator, const_iterator> eq = Base::equal_range(k);
+            return ft::distance(eq.first, eq.second);
         }
 
     private:
-        key_compare _comp;
-        allocator_type _alloc;
-
-        node_pointer aux_insert (node_pointer parent, node_pointer node, const value_type& val)
+        base_pointer aux_insert (base_pointer parent, base_pointer node, const value_type& val)
         {
             if (!node) {
                 node = Base::new_node(val);
                 node->parent = parent;
                 Base::_added_node_ptr = node;
                 ++Base::_size;
-            } else if (_comp(val, node->content)) {
+            } else if (Base::_comp(val, Base::value_of(node))) {
                 node->left = aux_insert(node, node->left, val);
-            } else if (_comp(node->content, val)) {
+            } else if (Base::_comp(Base::value_of(node), val)) {
                 node->right = aux_insert(node, node->right, val);
             } else {
                 node->right = aux_insert(node, node->right, val);
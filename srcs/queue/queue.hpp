@@ -18,6 +18,35 @@ class queue
         {
         }
 
+#ifdef FT_HAS_CXX11
+        explicit queue (container_type&& container)
+            : c(std::move(container))
+        {
+        }
+
+        queue (const queue& x)
+            : c(x.c)
+        {
+        }
+
+        queue (queue&& x)
+            : c(std::move(x.c))
+        {
+        }
+
+        queue& operator= (const queue& x)
+        {
+            c = x.c;
+            return *this;
+        }
+
+        queue& operator= (queue&& x)
+        {
+            c = std::move(x.c);
+            return *this;
+        }
+#endif
+
         ~queue()
         {
         }
@@ -31,6 +60,12 @@ class queue
         const value_type& back() const { return c.back(); }
 
         void push (const value_type& val) { c.push_back(val); }
+#ifdef FT_HAS_CXX11
+        void push (value_type&& val) { c.push_back(std::move(val)); }
+
+        template <class... Args>
+        void emplace (Args&&... args) { c.emplace_back(std::forward<Args>(args)...); }
+#endif
         void pop(void) { c.pop_front(); }
 
         friend bool operator== (const queue<T, Container>& rhs, const queue<T, container_type> lhs) { return rhs.c == lhs.c; }
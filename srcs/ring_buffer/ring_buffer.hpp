@@ -0,0 +1,439 @@
+#pragma once
+
+#include "ring_buffer_iterator.hpp"
+#include "../utils/utils.hpp"
+#include "../utils/algorithm.hpp"
+
+#include <cstddef> // std::ptrdiff_t, size_t, NULL
+#include <cstring> // std::memcpy
+
+#include <memory> // std::allocator
+#include <stdexcept> // std::out_of_range
+#include <limits> // std::numeric_limits
+#include <utility> // std::pair
+
+namespace ft {
+
+/* RING BUFFER */
+// circular buffer held in a single allocation whose capacity is a power of
+// two, the slot of an element is found with a mask. a full buffer doubles
+// its capacity, unless it is in overwrite mode where a push drops the
+// element at the opposite end. it can be the container of a queue or a stack
+template < class T, class Alloc = std::allocator<T> >
+class ring_buffer
+{
+    public:
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef ring_buffer_iterator<value_type, false> iterator;
+        typedef ring_buffer_iterator<value_type, true> const_iterator;
+        typedef reverse_ring_buffer_iterator<value_type, false> reverse_iterator;
+        typedef reverse_ring_buffer_iterator<value_type, true> const_reverse_iterator;
+        typedef std::ptrdiff_t difference_type;
+        typedef size_t size_type;
+        // a contiguous run of elements, the buffer holds at most two
+        typedef std::pair<pointer, size_type> span;
+        typedef std::pair<const_pointer, size_type> const_span;
+
+    public:
+        /* CONSTRUCTORS */
+        explicit ring_buffer (const allocator_type& alloc = allocator_type())
+            : _array(NULL), _capacity(0), _head(0), _size(0), _overwrite(false), _alloc(alloc)
+        {
+        }
+
+        explicit ring_buffer (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
+            : _array(NULL), _capacity(0), _head(0), _size(0), _overwrite(false), _alloc(alloc)
+        {
+            assign(n, val);
+        }
+
+        template <class InputIterator>
+        ring_buffer (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+            : _array(NULL), _capacity(0), _head(0), _size(0), _overwrite(false), _alloc(alloc)
+        {
+            assign(first, last);
+        }
+
+        // the copy has the same capacity & mode
+        ring_buffer (const ring_buffer& x)
+            : _array(NULL), _capacity(0), _head(0), _size(0), _overwrite(x._overwrite), _alloc(x._alloc)
+        {
+            reserve(x._capacity);
+            for (size_type i = 0; i < x._size; ++i)
+                _alloc.construct(_array + i, x[i]);
+            _size = x._size;
+        }
+
+#ifdef FT_HAS_CXX11
+        // x is left empty without any buffer
+        ring_buffer (ring_buffer&& x) noexcept
+            : _array(NULL), _capacity(0), _head(0), _size(0), _overwrite(x._overwrite), _alloc(x._alloc)
+        {
+            swap(x);
+        }
+#endif
+
+        /* DESTRUCTOR */
+        ~ring_buffer()
+        {
+            clear();
+            _alloc.deallocate(_array, _capacity);
+        }
+
+        /* OPERATORS */
+        // *this takes the mode of x & at least its capacity, which bounds
+        // the elements kept in overwrite mode
+        ring_buffer& operator= (const ring_buffer& x)
+        {
+            if (this != &x) {
+                clear();
+                _overwrite = x._overwrite;
+                reserve(x._capacity);
+                for (size_type i = 0; i < x._size; ++i)
+                    _alloc.construct(slot(i), x[i]);
+                _size = x._size;
+            }
+            return *this;
+        }
+
+#ifdef FT_HAS_CXX11
+        ring_buffer& operator= (ring_buffer&& x) noexcept
+        {
+            if (this != &x) {
+                clear();
+                swap(x);
+            }
+            return *this;
+        }
+#endif
+
+        friend bool operator== (const ring_buffer& lhs, const ring_buffer& rhs)
+        {
+            return lhs._size == rhs._size && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        friend bool operator< (const ring_buffer& lhs, const ring_buffer& rhs)
+        {
+            return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend bool operator!= (const ring_buffer& lhs, const ring_buffer& rhs) { return !(lhs == rhs); }
+        friend bool operator<= (const ring_buffer& lhs, const ring_buffer& rhs) { return !(rhs < lhs); }
+        friend bool operator> (const ring_buffer& lhs, const ring_buffer& rhs) { return rhs < lhs; }
+        friend bool operator>= (const ring_buffer& lhs, const ring_buffer& rhs) { return !(lhs < rhs); }
+
+        /* ITERATORS */
+        iterator begin() { return iterator(_head, _array, _capacity - 1); }
+        const_iterator begin() const { return const_iterator(_head, _array, _capacity - 1); }
+        iterator end() { return iterator(_head + _size, _array, _capacity - 1); }
+        const_iterator end() const { return const_iterator(_head + _size, _array, _capacity - 1); }
+        reverse_iterator rbegin() { return reverse_iterator(_head + _size - 1, _array, _capacity - 1); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(_head + _size - 1, _array, _capacity - 1); }
+        reverse_iterator rend() { return reverse_iterator(_head - 1, _array, _capacity - 1); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(_head - 1, _array, _capacity - 1); }
+
+        /* CAPACITY */
+        size_type size() const { return _size; }
+        size_type max_size() const { return _alloc.max_size(); }
+        size_type capacity() const { return _capacity; }
+        bool empty() const { return _size == 0; }
+        bool full() const { return _size == _capacity; }
+
+        // the capacity is rounded up to a power of two
+        void reserve (size_type n)
+        {
+            if (n <= _capacity)
+                return ;
+            size_type new_capacity = 1;
+            while (new_capacity < n)
+                new_capacity *= 2;
+            realloc(new_capacity);
+        }
+
+        void resize (size_type n, value_type val = value_type())
+        {
+            if (_size < n) {
+                reserve(n);
+                while (_size < n)
+                    push_back(val);
+            } else {
+                while (n < _size)
+                    pop_back();
+            }
+        }
+
+        // in overwrite mode a push into a full buffer drops the element at
+        // the other end instead of growing the buffer
+        void set_overwrite (bool overwrite) { _overwrite = overwrite; }
+        bool overwrite() const { return _overwrite; }
+
+        /* ELEMENT ACCESS */
+        reference front () { return *slot(0); }
+        const_reference front () const { return *slot(0); }
+        reference back () { return *slot(_size - 1); }
+        const_reference back () const { return *slot(_size - 1); }
+
+        reference at (size_type n)
+        {
+            if (n >= _size)
+                throw std::out_of_range("ft::ring_buffer");
+            return *slot(n);
+        }
+
+        const_reference at (size_type n) const
+        {
+            if (n >= _size)
+                throw std::out_of_range("ft::ring_buffer");
+            return *slot(n);
+        }
+
+        reference operator[] (size_type n) { return *slot(n); }
+        const_reference operator[] (size_type n) const { return *slot(n); }
+
+        // SPANS
+        // the elements from the front up to the end of the buffer, then the
+        // ones wrapped around to its start, ready for a writev
+        span first_span () { return span(_array + _head, first_span_size()); }
+        const_span first_span () const { return const_span(_array + _head, first_span_size()); }
+        span second_span () { return span(_array, _size - first_span_size()); }
+        const_span second_span () const { return const_span(_array, _size - first_span_size()); }
+
+        /* MODIFIERS */
+        template <class InputIterator>
+        void assign (InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+        {
+            clear();
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        void assign (size_type n, const value_type& val)
+        {
+            // val may refer to an element which is about to be destroyed
+            value_type copy (val);
+            clear();
+            reserve(n);
+            for (size_type i = 0; i < n; ++i)
+                _alloc.construct(slot(i), copy);
+            _size = n;
+        }
+
+        // PUSH N POP
+        void push_back (const value_type& val)
+        {
+            if (_size == _capacity) {
+                // val may refer to an element which is about to be dropped or moved
+                value_type copy (val);
+                make_room(false);
+                _alloc.construct(slot(_size), copy);
+            } else {
+                _alloc.construct(slot(_size), val);
+            }
+            ++_size;
+        }
+
+        void push_front (const value_type& val)
+        {
+            if (_size == _capacity) {
+                value_type copy (val);
+                make_room(true);
+                _alloc.construct(slot(_capacity - 1), copy);
+            } else {
+                _alloc.construct(slot(_capacity - 1), val);
+            }
+            _head = (_head - 1) & (_capacity - 1);
+            ++_size;
+        }
+
+#ifdef FT_HAS_CXX11
+        void push_back (value_type&& val)
+        {
+            emplace_back(std::move(val));
+        }
+
+        void push_front (value_type&& val)
+        {
+            emplace_front(std::move(val));
+        }
+
+        template <class... Args>
+        void emplace_back (Args&&... args)
+        {
+            if (_size == _capacity) {
+                value_type tmp (std::forward<Args>(args)...);
+                make_room(false);
+                _alloc.construct(slot(_size), std::move(tmp));
+            } else {
+                _alloc.construct(slot(_size), std::forward<Args>(args)...);
+            }
+            ++_size;
+        }
+
+        template <class... Args>
+        void emplace_front (Args&&... args)
+        {
+            if (_size == _capacity) {
+                value_type tmp (std::forward<Args>(args)...);
+                make_room(true);
+                _alloc.construct(slot(_capacity - 1), std::move(tmp));
+            } else {
+                _alloc.construct(slot(_capacity - 1), std::forward<Args>(args)...);
+            }
+            _head = (_head - 1) & (_capacity - 1);
+            ++_size;
+        }
+#endif
+
+        void pop_front (void)
+        {
+            _alloc.destroy(slot(0));
+            _head = (_head + 1) & (_capacity - 1);
+            --_size;
+        }
+
+        void pop_back (void)
+        {
+            --_size;
+            _alloc.destroy(slot(_size));
+        }
+
+        // drops the n first elements, once a writev consumed them
+        void pop_front_n (size_type n)
+        {
+            destroy_range(0, n);
+            _head = (_head + n) & (_capacity - 1);
+            _size -= n;
+        }
+
+        void swap (ring_buffer& x)
+        {
+            ft::swap(_array, x._array);
+            ft::swap(_capacity, x._capacity);
+            ft::swap(_head, x._head);
+            ft::swap(_size, x._size);
+            ft::swap(_overwrite, x._overwrite);
+            ft::swap(_alloc, x._alloc);
+        }
+
+        void clear (void)
+        {
+            destroy_range(0, _size);
+            _head = 0;
+            _size = 0;
+        }
+
+    private:
+        pointer _array;
+        size_type _capacity;
+        size_type _head;
+        size_type _size;
+        bool _overwrite;
+        allocator_type _alloc;
+
+        pointer slot (size_type n) const { return _array + ((_head + n) & (_capacity - 1)); }
+
+        size_type first_span_size (void) const { return ft::min(_size, _capacity - _head); }
+
+        // frees a slot in a full buffer
+        void make_room (bool at_front)
+        {
+            if (_overwrite && _capacity > 0) {
+                if (at_front)
+                    pop_back();
+                else
+                    pop_front();
+                return ;
+            }
+            realloc(_capacity ? _capacity * 2 : 1);
+        }
+
+        // the elements copied to a buffer realloc hasn't adopted yet, they
+        // are destroyed & the buffer is freed if a copy throws
+        struct new_buffer
+        {
+            ring_buffer& ring;
+            pointer array;
+            size_type capacity;
+            size_type copied;
+
+            ~new_buffer()
+            {
+                if (!array)
+                    return ;
+                for (size_type i = 0; i < copied; ++i)
+                    ring._alloc.destroy(array + i);
+                ring._alloc.deallocate(array, capacity);
+            }
+        };
+
+        // the elements are moved to the start of the new buffer, the ones
+        // which may throw while moved are all copied before the originals
+        // are destroyed, a throwing copy leaves them untouched
+        void realloc (size_type new_capacity)
+        {
+            new_buffer buf = { *this, _alloc.allocate(new_capacity), new_capacity, 0 };
+            if (ft::is_nothrow_relocatable<value_type>::value) {
+                size_type first = first_span_size();
+                relocate(buf.array, _array + _head, first);
+                relocate(buf.array + first, _array, _size - first);
+            } else {
+                for (; buf.copied < _size; ++buf.copied) {
+#ifdef FT_HAS_CXX11
+                    _alloc.construct(buf.array + buf.copied, std::move_if_noexcept(*slot(buf.copied)));
+#else
+                    _alloc.construct(buf.array + buf.copied, *slot(buf.copied));
+#endif
+                }
+                destroy_range(0, _size);
+            }
+            _alloc.deallocate(_array, _capacity);
+            _array = buf.array;
+            _capacity = new_capacity;
+            _head = 0;
+            buf.array = NULL;
+        }
+
+        // to a distinct buffer
+        void relocate (pointer dst, pointer src, size_type n)
+        {
+            if (n == 0)
+                return ;
+            if (ft::is_trivially_relocatable<value_type>::value) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+                return ;
+            }
+            for (size_type i = 0; i < n; ++i) {
+#ifdef FT_HAS_CXX11
+                _alloc.construct(dst + i, std::move_if_noexcept(src[i]));
+#else
+                _alloc.construct(dst + i, src[i]);
+#endif
+                _alloc.destroy(src + i);
+            }
+        }
+
+        // trivially copyable types have nothing to destroy
+        void destroy_range (size_type first, size_type last)
+        {
+            if (ft::is_trivially_copyable<value_type>::value)
+                return ;
+            for (; first < last; ++first)
+                _alloc.destroy(slot(first));
+        }
+
+}; // CLASS RING_BUFFER
+
+template <class T, class Alloc>
+void swap (ring_buffer<T, Alloc>& x, ring_buffer<T, Alloc>& y)
+{
+    x.swap(y);
+}
+
+} // NAMESPACE FT
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "../utils/utils.hpp"
+#include <cstddef> // NULL, std::ptrdiff_t, size_t
+#include <iterator> // std::random_access_iterator_tag
+
+namespace ft {
+
+// the index of an iterator grows past the capacity of the buffer, it is
+// only wrapped around by the mask when the iterator is dereferenced
+template <class T, bool is_const>
+class ring_buffer_iterator
+{
+    public:
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename choose<is_const, const T *, T *>::type pointer;
+        typedef typename choose<is_const, const T &, T &>::type reference;
+        typedef std::random_access_iterator_tag iterator_category;
+
+    private:
+        typedef ring_buffer_iterator<value_type, is_const> self_type;
+        typedef size_t size_type;
+
+    public:
+        ring_buffer_iterator (size_type index = 0, pointer array = NULL, size_type mask = 0)
+            : _index(index), _array(array), _mask(mask)
+        {
+        }
+
+        ring_buffer_iterator (const ring_buffer_iterator<value_type, false>& other)
+            : _index(other.get_index()), _array(other.get_array()), _mask(other.get_mask())
+        {
+        }
+
+        /* OPERATORS */
+        ring_buffer_iterator &operator= (const self_type& other)
+        {
+            if (this != &other) {
+                _index = other._index;
+                _array = other._array;
+                _mask = other._mask;
+            }
+            return *this;
+        }
+
+        pointer operator-> (void) { return _array + (_index & _mask); }
+        reference operator* (void) { return _array[_index & _mask]; }
+        reference operator[] (size_type n) { return _array[(_index + n) & _mask]; }
+
+        friend bool operator== (const self_type& lhs, const self_type& rhs) { return lhs._index == rhs._index; }
+        friend bool operator< (const self_type& lhs, const self_type& rhs) { return rhs - lhs > 0; }
+        friend bool operator!= (const self_type& lhs, const self_type& rhs) { return !(lhs == rhs); }
+        friend bool operator> (const self_type& lhs, const self_type& rhs) { return rhs < lhs; }
+        friend bool operator<= (const self_type& lhs, const self_type& rhs) { return !(rhs < lhs); }
+        friend bool operator>= (const self_type& lhs, const self_type& rhs) { return !(lhs < rhs); }
+
+        /* ITERATOR SUBTRACTION */
+        friend difference_type operator- (const self_type& lhs, const self_type& rhs) { return lhs._index - rhs._index; }
+
+        /* INCREMENTING & DECREMENTING */
+        self_type& operator++ (void)
+        {
+            ++_index;
+            return *this;
+        }
+
+        self_type operator++ (int)
+        {
+            self_type tmp = *this;
+            ++_index;
+            return tmp;
+        }
+
+        self_type& operator-- (void)
+        {
+            --_index;
+            return *this;
+        }
+
+        self_type operator-- (int)
+        {
+            self_type tmp = *this;
+            --_index;
+            return tmp;
+        }
+
+        /* ITERATOR & INTEGER ARITHMETIC */
+        self_type& operator+= (difference_type n)
+        {
+            _index += n;
+            return *this;
+        }
+
+        self_type& operator-= (difference_type n)
+        {
+            return *this += -n;
+        }
+
+        self_type operator+ (difference_type n)
+        {
+            self_type tmp = *this;
+            return tmp += n;
+        }
+
+        self_type operator- (difference_type n)
+        {
+            self_type tmp = *this;
+            return tmp -= n;
+        }
+
+        friend self_type operator+ (difference_type n, const self_type& rhs)
+        {
+            self_type tmp = rhs;
+            return tmp += n;
+        }
+
+        /* GETTERS */
+        size_type get_index (void) const { return _index; }
+        pointer get_array (void) const { return _array; }
+        size_type get_mask (void) const { return _mask; }
+
+    private:
+        size_type _index;
+        pointer _array;
+        size_type _mask;
+
+}; // CLASS RING_BUFFER_ITERATOR
+
+template <class T, bool is_const>
+class reverse_ring_buffer_iterator
+{
+    public:
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename choose<is_const, const T *, T *>::type pointer;
+        typedef typename choose<is_const, const T &, T &>::type reference;
+        typedef std::random_access_iterator_tag iterator_category;
+
+    private:
+        typedef reverse_ring_buffer_iterator<value_type, is_const> self_type;
+        typedef size_t size_type;
+
+    public:
+        reverse_ring_buffer_iterator (size_type index = 0, pointer array = NULL, size_type mask = 0)
+            : _index(index), _array(array), _mask(mask)
+        {
+        }
+
+        reverse_ring_buffer_iterator (const reverse_ring_buffer_iterator<value_type, false>& other)
+            : _index(other.get_index()), _array(other.get_array()), _mask(other.get_mask())
+        {
+        }
+
+        /* OPERATORS */
+        reverse_ring_buffer_iterator &operator= (const self_type& other)
+        {
+            if (this != &other) {
+                _index = other._index;
+                _array = other._array;
+                _mask = other._mask;
+            }
+            return *this;
+        }
+
+        pointer operator-> (void) { return _array + (_index & _mask); }
+        reference operator* (void) { return _array[_index & _mask]; }
+        reference operator[] (size_type n) { return _array[(_index - n) & _mask]; }
+
+        friend bool operator== (const self_type& lhs, const self_type& rhs) { return lhs._index == rhs._index; }
+        friend bool operator< (const self_type& lhs, const self_type& rhs) { return rhs - lhs > 0; }
+        friend bool operator!= (const self_type& lhs, const self_type& rhs) { return !(lhs == rhs); }
+        friend bool operator> (const self_type& lhs, const self_type& rhs) { return rhs < lhs; }
+        friend bool operator<= (const self_type& lhs, const self_type& rhs) { return !(rhs < lhs); }
+        friend bool operator>= (const self_type& lhs, const self_type& rhs) { return !(lhs < rhs); }
+
+        /* ITERATOR SUBTRACTION */
+        friend difference_type operator- (const self_type& lhs, const self_type& rhs) { return rhs._index - lhs._index; }
+
+        /* INCREMENTING & DECREMENTING */
+        self_type& operator++ (void)
+        {
+            --_index;
+            return *this;
+        }
+
+        self_type operator++ (int)
+        {
+            self_type tmp = *this;
+            --_index;
+            return tmp;
+        }
+
+        self_type& operator-- (void)
+        {
+            ++_index;
+            return *this;
+        }
+
+        self_type operator-- (int)
+        {
+            self_type tmp = *this;
+            ++_index;
+            return tmp;
+        }
+
+        /* ITERATOR & INTEGER ARITHMETIC */
+        self_type& operator+= (difference_type n)
+        {
+            _index -= n;
+            return *this;
+        }
+
+        self_type& operator-= (difference_type n)
+        {
+            _index += n;
+            return *this;
+        }
+
+        self_type operator+ (difference_type n)
+        {
+            self_type tmp = *this;
+            return tmp += n;
+        }
+
+        self_type operator- (difference_type n)
+        {
+            self_type tmp = *this;
+            return tmp -= n;
+        }
+
+        friend self_type operator+ (difference_type n, const self_type& rhs)
+        {
+            self_type tmp = rhs;
+            return tmp += n;
+        }
+
+        /* GETTERS */
+        size_type get_index (void) const { return _index; }
+        pointer get_array (void) const { return _array; }
+        size_type get_mask (void) const { return _mask; }
+
+    private:
+        size_type _index;
+        pointer _array;
+        size_type _mask;
+
+}; // CLASS REVERSE_RING_BUFFER_ITERATOR
+
+} // NAMESPACE FT
@@ -43,24 +43,39 @@ class set : public avl_tree<T, Compare, Alloc>
     public:
         /* CONSTRUCTORS */
         explicit set (const value_compare& comp = value_compare(), const allocator_type& alloc = allocator_type())
-            : _comp(comp), _alloc(alloc)
+            : Base(comp, alloc)
         {
         }
 
         template <class InputIterator>
         set (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(),
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
-            : _comp(comp), _alloc(alloc)
+            : Base(comp, alloc)
         {
             Base::insert(first, last);
         }
 
+        // the caller guarantees that [first, last) is sorted w/o duplicates
+        template <class InputIterator>
+        static set from_sorted (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+        {
+            set ret (comp, alloc);
+            ret.aux_build_sorted(first, last, false, false);
+            return ret;
+        }
+
         set (const set& x)
-            : _comp(x._comp), _alloc(x._alloc)
+            : Base(x)
         {
-            *this = x;
         }
 
+#ifdef FT_HAS_CXX11
+        set (set&& x)
+            : Base(std::move(x))
+        {
+        }
+#endif
+
         /* DESTRUCTOR */
         ~set()
         {
@@ -70,21 +85,24 @@ class set : public avl_tree<T, Compare, Alloc>
         set& operator= (const set& x)
         {
             if (this != &x) {
-                _comp = x._comp;
-                Base::clear();
-                for (const_iterator it = x.begin(); it != x.end(); ++it)
-                    Base::insert(*it);
+                Base::operator=(x);
             }
             return *this;
         }
 
-        /* OBSERVERS */
-        key_compare key_comp (void) const { return _comp; }
-        value_compare value_comp (void) const { return _comp; }
+#ifdef FT_HAS_CXX11
+        set& operator= (set&& x)
+        {
+            if (this != &x) {
+                Base::operator=(std::move(x));
+            }
+            return *this;
+        }
+#endif
 
-    private:
-        value_compare _comp;
-        allocator_type _alloc;
+        /* OBSERVERS */
+        key_compare key_comp (void) const { return Base::_comp; }
+        value_compare value_comp (void) const { return Base::_comp; }
 
 }; // CLASS MAP
 
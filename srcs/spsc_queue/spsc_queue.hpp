@@ -0,0 +1,315 @@
+#pragma once
+
+#include "../deque/chunk_policy.hpp"
+#include "../utils/utils.hpp"
+
+// the queue is built on C++11 atomics, it is not available without them
+#ifdef FT_HAS_CXX11
+
+#include <atomic> // std::atomic
+#include <cstddef> // NULL, size_t
+#include <memory> // std::allocator
+#include <new> // placement new
+#include <utility> // std::forward, std::move
+
+namespace ft {
+
+/* SPSC QUEUE */
+// wait-free queue between a single producer thread & a single consumer
+// thread. the elements are stored in chunks linked from the oldest to the
+// newest, like the chunks of a deque without its map. the producer fills
+// the chunk at the tail & links a new one once it is full, the consumer
+// drains the chunk at the head & hands it back to the producer as a spare
+//
+// the element i lives in the slot i % chunk_size of its chunk, the producer
+// publishes its elements by storing the count of pushes with release
+// semantics, the consumer does the same with the count of pops. each side
+// keeps its cursors on its own cache line & a cached copy of the other
+// side's count, which it only reloads when it seems to be blocked
+//
+// max_size bounds the number of elements in the queue, 0 leaves it unbounded
+template < class T, class Alloc = std::allocator<T>, class ChunkPolicy = ft::chunk_bytes<> >
+class spsc_queue
+{
+    public:
+        static const size_t chunk_size = ChunkPolicy::template elements<T>::value;
+
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef ChunkPolicy chunk_policy;
+        typedef size_t size_type;
+
+    private:
+        static const size_t cache_line = 64;
+
+        struct chunk
+        {
+            std::atomic<chunk*> next;
+            alignas(T) unsigned char slots[chunk_size * sizeof(T)];
+
+            T* slot (size_type i) { return reinterpret_cast<T*>(slots) + i; }
+        };
+
+        typedef typename allocator_type::template rebind<chunk>::other chunk_allocator_type;
+
+    public:
+        /* CONSTRUCTORS */
+        explicit spsc_queue (size_type max_size = 0, const allocator_type& alloc = allocator_type())
+            : _alloc(alloc), _chunk_alloc(alloc), _max_size(max_size), _spare(NULL)
+        {
+            chunk * c = new_chunk();
+            _tail = 0;
+            _tail_chunk = c;
+            _cached_head = 0;
+            _head = 0;
+            _head_chunk = c;
+            _cached_tail = 0;
+        }
+
+        spsc_queue (const spsc_queue&) = delete;
+        spsc_queue& operator= (const spsc_queue&) = delete;
+
+        /* DESTRUCTOR */
+        // no thread may use the queue anymore
+        ~spsc_queue()
+        {
+            size_type head = _head.load(std::memory_order_relaxed);
+            size_type tail = _tail.load(std::memory_order_relaxed);
+            for (; head != tail; ++head) {
+                chunk * c = head_chunk(head);
+                _alloc.destroy(c->slot(head % chunk_size));
+                leave_head_chunk(c);
+            }
+            // pushes which threw may have linked empty chunks after the last one
+            for (chunk * c = _head_chunk; c; ) {
+                chunk * next = c->next.load(std::memory_order_relaxed);
+                delete_chunk(c);
+                c = next;
+            }
+            delete_chunk(_spare.load(std::memory_order_relaxed));
+        }
+
+        /* CAPACITY */
+        // exact when called from either side while the other is idle. the
+        // head is read first, the tail can only have moved further since so
+        // the difference never wraps around, it may still count elements
+        // pushed after the head was read & is clamped to max_size
+        size_type size (void) const
+        {
+            size_type head = _head.load(std::memory_order_acquire);
+            size_type tail = _tail.load(std::memory_order_acquire);
+            return _max_size ? ft::min(tail - head, _max_size) : tail - head;
+        }
+
+        bool empty (void) const { return size() == 0; }
+        size_type max_size (void) const { return _max_size; }
+
+        /* PRODUCER */
+        // fails if the queue holds max_size elements
+        bool try_push (const value_type& val)
+        {
+            return try_emplace(val);
+        }
+
+        bool try_push (value_type&& val)
+        {
+            return try_emplace(std::move(val));
+        }
+
+        template <class... Args>
+        bool try_emplace (Args&&... args)
+        {
+            size_type tail = _tail.load(std::memory_order_relaxed);
+            if (_max_size && tail - _cached_head >= _max_size) {
+                _cached_head = _head.load(std::memory_order_acquire);
+                if (tail - _cached_head >= _max_size)
+                    return false;
+            }
+            chunk * c = _tail_chunk;
+            if (tail % chunk_size == 0 && tail != 0)
+                c = next_tail_chunk(c);
+            _alloc.construct(c->slot(tail % chunk_size), std::forward<Args>(args)...);
+            _tail_chunk = c;
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // pushes as many of the n elements from src as fit, they are
+        // published at once, returns their count. if building one throws
+        // the ones already built are destroyed & none is published
+        template <class InputIterator>
+        size_type try_push_n (InputIterator src, size_type n)
+        {
+            size_type tail = _tail.load(std::memory_order_relaxed);
+            if (_max_size) {
+                if (tail - _cached_head + n > _max_size)
+                    _cached_head = _head.load(std::memory_order_acquire);
+                n = ft::min(n, _max_size - (tail - _cached_head));
+            }
+            push_batch batch = { *this, tail, n, 0 };
+            chunk * c = _tail_chunk;
+            for (; batch.built < n; ++batch.built, ++src) {
+                size_type i = tail + batch.built;
+                if (i % chunk_size == 0 && i != 0)
+                    c = next_tail_chunk(c);
+                _alloc.construct(c->slot(i % chunk_size), *src);
+            }
+            _tail_chunk = c;
+            if (n)
+                _tail.store(tail + n, std::memory_order_release);
+            return n;
+        }
+
+        /* CONSUMER */
+        // fails if the queue is empty, the element is moved into val
+        bool try_pop (value_type& val)
+        {
+            size_type head = _head.load(std::memory_order_relaxed);
+            if (head == _cached_tail) {
+                _cached_tail = _tail.load(std::memory_order_acquire);
+                if (head == _cached_tail)
+                    return false;
+            }
+            chunk * c = head_chunk(head);
+            value_type * p = c->slot(head % chunk_size);
+            val = std::move(*p);
+            _alloc.destroy(p);
+            leave_head_chunk(c);
+            _head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // pops up to n elements into dst, they are released at once,
+        // returns their count. if moving one throws the ones already
+        // popped are still released & it stays at the head
+        template <class OutputIterator>
+        size_type try_pop_n (OutputIterator dst, size_type n)
+        {
+            size_type head = _head.load(std::memory_order_relaxed);
+            if (_cached_tail - head < n)
+                _cached_tail = _tail.load(std::memory_order_acquire);
+            n = ft::min(n, _cached_tail - head);
+            pop_batch batch = { *this, head, 0 };
+            for (; batch.popped < n; ++batch.popped, ++dst) {
+                chunk * c = head_chunk(head + batch.popped);
+                value_type * p = c->slot((head + batch.popped) % chunk_size);
+                *dst = std::move(*p);
+                _alloc.destroy(p);
+                leave_head_chunk(c);
+            }
+            return n;
+        }
+
+    private:
+        allocator_type _alloc;
+        chunk_allocator_type _chunk_alloc;
+        size_type _max_size;
+        // a drained chunk waiting to be reused by the producer
+        std::atomic<chunk*> _spare;
+
+        // producer side
+        alignas(cache_line) std::atomic<size_type> _tail;
+        chunk * _tail_chunk;
+        size_type _cached_head;
+
+        // consumer side, the alignment also pads the end of the queue
+        alignas(cache_line) std::atomic<size_type> _head;
+        chunk * _head_chunk;
+        size_type _cached_tail;
+
+        chunk * new_chunk (void)
+        {
+            chunk * c = _chunk_alloc.allocate(1);
+            ::new (static_cast<void*>(&c->next)) std::atomic<chunk*>(NULL);
+            return c;
+        }
+
+        void delete_chunk (chunk * c)
+        {
+            if (c)
+                _chunk_alloc.deallocate(c, 1);
+        }
+
+        // the chunk after the full chunk c, the producer links the spare
+        // chunk or a new one the first time it needs it. the chunk only
+        // becomes the tail chunk once an element is built in it, a push
+        // which throws leaves it linked & empty for the next one
+        chunk * next_tail_chunk (chunk * c)
+        {
+            chunk * next = c->next.load(std::memory_order_relaxed);
+            if (next)
+                return next;
+            next = _spare.exchange(NULL, std::memory_order_acquire);
+            if (next)
+                next->next.store(NULL, std::memory_order_relaxed);
+            else
+                next = new_chunk();
+            c->next.store(next, std::memory_order_release);
+            return next;
+        }
+
+        // the chunk of the element head, the next one once the head chunk
+        // is drained. an element was published in it, so it is linked
+        chunk * head_chunk (size_type head)
+        {
+            if (head % chunk_size == 0 && head != 0)
+                return _head_chunk->next.load(std::memory_order_acquire);
+            return _head_chunk;
+        }
+
+        // the consumer only leaves its chunk once it popped an element of
+        // the next one c, the producer is done with it & gets it back as
+        // its spare
+        void leave_head_chunk (chunk * c)
+        {
+            if (c == _head_chunk)
+                return ;
+            delete_chunk(_spare.exchange(_head_chunk, std::memory_order_release));
+            _head_chunk = c;
+        }
+
+        // the elements try_push_n built so far, they are destroyed if
+        // building the next one throws
+        struct push_batch
+        {
+            spsc_queue& queue;
+            size_type tail;
+            size_type n;
+            size_type built;
+
+            ~push_batch()
+            {
+                if (built == n)
+                    return ;
+                chunk * c = queue._tail_chunk;
+                for (size_type i = tail; i < tail + built; ++i) {
+                    if (i % chunk_size == 0 && i != 0)
+                        c = c->next.load(std::memory_order_relaxed);
+                    queue._alloc.destroy(c->slot(i % chunk_size));
+                }
+            }
+        };
+
+        // the elements try_pop_n popped so far, they are released at once
+        // even if moving the next one throws
+        struct pop_batch
+        {
+            spsc_queue& queue;
+            size_type head;
+            size_type popped;
+
+            ~pop_batch()
+            {
+                if (popped)
+                    queue._head.store(head + popped, std::memory_order_release);
+            }
+        };
+
+}; // CLASS SPSC_QUEUE
+
+template <class T, class Alloc, class ChunkPolicy>
+const size_t spsc_queue<T, Alloc, ChunkPolicy>::chunk_size;
+
+} // NAMESPACE FT
+
+#endif
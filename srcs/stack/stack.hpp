@@ -18,6 +18,35 @@ class stack
         {
         }
 
+#ifdef FT_HAS_CXX11
+        explicit stack (container_type&& container)
+            : c(std::move(container))
+        {
+        }
+
+        stack (const stack& x)
+            : c(x.c)
+        {
+        }
+
+        stack (stack&& x)
+            : c(std::move(x.c))
+        {
+        }
+
+        stack& operator= (const stack& x)
+        {
+            c = x.c;
+            return *this;
+        }
+
+        stack& operator= (stack&& x)
+        {
+            c = std::move(x.c);
+            return *this;
+        }
+#endif
+
         ~stack()
         {
         }
@@ -29,6 +58,12 @@ class stack
         const value_type& top(void) const { return c.back(); }
 
         void push (const value_type& val) { c.push_back(val); }
+#ifdef FT_HAS_CXX11
+        void push (value_type&& val) { c.push_back(std::move(val)); }
+
+        template <class... Args>
+        void emplace (Args&&... args) { c.emplace_back(std::forward<Args>(args)...); }
+#endif
         void pop(void) { c.pop_back(); }
 
         friend bool operator== (const stack<T, Container>& rhs, const stack<T, container_type> lhs) { return rhs.c == lhs.c; }
@@ -3,7 +3,7 @@
 #include "avl_node.hpp"
 #include "../utils/utils.hpp"
 
-#include <cstddef> // std.:ptrdiff_t, NULL
+#include <cstddef> // std::ptrdiff_t, NULL
 #include <iterator> // std::bidirectional_iterator_tag
 
 namespace ft {
@@ -20,11 +20,12 @@ class avl_iterator
 
     private:
         typedef avl_iterator<value_type, is_const> self_type;
-        typedef typename choose<is_const, const avl_node<value_type>*, avl_node<value_type>*>::type node_pointer;
+        typedef typename choose<is_const, const avl_node_base*, avl_node_base*>::type node_pointer;
+        typedef typename choose<is_const, const avl_node<value_type>*, avl_node<value_type>*>::type value_node_pointer;
 
     public:
         /* CONSTRUCTORS */
-        avl_iterator (avl_node<value_type>* node = NULL)
+        avl_iterator (node_pointer node = NULL)
             : _node(node)
         {
         }
@@ -45,29 +46,12 @@ class avl_iterator
         friend bool operator== (const self_type& rhs, const self_type& lhs) { return rhs._node == lhs._node; }
         friend bool operator!= (const self_type& rhs, const self_type& lhs) { return rhs._node != lhs._node; }
 
-        reference operator* (void) { return _node->content; }
-        pointer operator-> (void) { return &_node->content; }
+        reference operator* (void) { return static_cast<value_node_pointer>(_node)->content; }
+        pointer operator-> (void) { return &static_cast<value_node_pointer>(_node)->content; }
 
-        /* if there is a right subtree goto it's smallest node
-         * else if we are done w/ left subtree go to subtree root
-         * else if we are done w/ right subtree go to subtree root parent
-         */
         self_type& operator++ (void)
         {
-            node_pointer parent = _node->parent;
-            if (_node->right) {
-                _node = _node->right;
-                while (_node->left)
-                    _node = _node->left;
-            } else if (_node == parent->left) {
-                _node = parent;
-            } else {
-                while (_node == parent->right) {
-                    _node = parent;
-                    parent = _node->parent;
-                }
-                _node = _node->parent;
-            }
+            _node = avl_next(_node);
             return *this;
         }
 
@@ -80,20 +64,7 @@ class avl_iterator
 
         self_type& operator-- (void)
         {
-            node_pointer parent = _node->parent;
-            if (_node->left) {
-                _node = _node->left;
-                while (_node->right)
-                    _node = _node->right;
-            } else if (_node == parent->right) {
-                _node = parent;
-            } else {
-                while (_node == parent->left) {
-                    _node = parent;
-                    parent = _node->parent;
-                }
-                _node = _node->parent;
-            }
+            _node = avl_prev(_node);
             return *this;
         }
 
@@ -124,7 +95,8 @@ class reverse_avl_iterator
 
     private:
         typedef reverse_avl_iterator<T, is_const> self_type;
-        typedef typename choose<is_const, const avl_node<value_type>*, avl_node<value_type>*>::type node_pointer;
+        typedef typename choose<is_const, const avl_node_base*, avl_node_base*>::type node_pointer;
+        typedef typename choose<is_const, const avl_node<value_type>*, avl_node<value_type>*>::type value_node_pointer;
 
     public:
         /* CONSTRUCTORS */
@@ -149,29 +121,12 @@ class reverse_avl_iterator
         friend bool operator== (const self_type& rhs, const self_type& lhs) { return rhs._node == lhs._node; }
         friend bool operator!= (const self_type& rhs, const self_type& lhs) { return rhs._node != lhs._node; }
 
-        reference operator* (void) { return _node->content; }
-        pointer operator-> (void) { return &_node->content; }
+        reference operator* (void) { return static_cast<value_node_pointer>(_node)->content; }
+        pointer operator-> (void) { return &static_cast<value_node_pointer>(_node)->content; }
 
-        /* if there is a right subtree goto it's smallest node
-         * else if we are done w/ left subtree go to subtree root
-         * else if we are done w/ right subtree go to subtree root parent
-         */
         self_type& operator++ (void)
         {
-            node_pointer parent = _node->parent;
-            if (_node->left) {
-                _node = _node->left;
-                while (_node->right)
-                    _node = _node->right;
-            } else if (_node == parent->right) {
-                _node = parent;
-            } else {
-                while (_node == parent->left) {
-                    _node = parent;
-                    parent = _node->parent;
-                }
-                _node = _node->parent;
-            }
+            _node = avl_prev(_node);
             return *this;
         }
 
@@ -184,20 +139,7 @@ class reverse_avl_iterator
 
         self_type& operator-- (void)
         {
-            node_pointer parent = _node->parent;
-            if (_node->right) {
-                _node = _node->right;
-                while (_node->left)
-                    _node = _node->left;
-            } else if (_node == parent->left) {
-                _node = parent;
-            } else {
-                while (_node == parent->right) {
-                    _node = parent;
-                    parent = _node->parent;
-                }
-                _node = _node->parent;
-            }
+            _node = avl_next(_node);
             return *this;
         }
 
@@ -216,4 +158,15 @@ class reverse_avl_iterator
 
 }; // CLASS REVERSE_AVL_ITERATOR
 
+/* DISTANCE */
+// O(log n) alternative to std::distance using the subtree sizes,
+// both iterators have to belong to the same tree
+template <class T, bool is_const>
+typename avl_iterator<T, is_const>::difference_type distance (const avl_iterator<T, is_const>& first, const avl_iterator<T, is_const>& last)
+{
+    typedef typename avl_iterator<T, is_const>::difference_type difference_type;
+
+    return static_cast<difference_type>(avl_rank(last.get_node())) - static_cast<difference_type>(avl_rank(first.get_node()));
+}
+
 }; // NAMESPACE FT
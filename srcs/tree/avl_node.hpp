@@ -1,23 +1,266 @@
 #pragma once
 
-#include <cstddef> // NULL
+#include "../utils/utils.hpp" // in_place_t
+
+#include <cstddef> // NULL, size_t
 
 namespace ft {
 
+// the links of a node without its content, the tree embeds one as its
+// header: the root hangs as its left child, its right link points to the
+// min node & it is its own parent, which makes it the end of the inorder
+// traversal in both directions
+struct avl_node_base
+{
+    int height;
+    size_t size; // number of nodes in the subtree rooted here
+    avl_node_base * left;
+    avl_node_base * right;
+    avl_node_base * parent;
+
+    avl_node_base (void)
+        : height(0), size(1), left(NULL), right(NULL), parent(NULL)
+    {
+    }
+
+}; // STRUCT AVL_NODE_BASE
+
 template <class T>
-struct avl_node
+struct avl_node : avl_node_base
 {
     T content;
-    int height;
-    avl_node * left;
-    avl_node * right;
-    avl_node * parent;
 
     avl_node (const T& cont = T())
-        : content(cont), height(0), left(NULL), right(NULL), parent(NULL)
+        : avl_node_base(), content(cont)
+    {
+    }
+
+#ifdef FT_HAS_CXX11
+    template <class... Args>
+    avl_node (in_place_t, Args&&... args)
+        : avl_node_base(), content(std::forward<Args>(args)...)
     {
     }
+#endif
 
 }; // STRUCT AVL_NODE
 
+/* RANK */
+// number of nodes preceding node in an inorder traversal, the walk up
+// stops below the header which is its own parent, the header itself is
+// ranked as the size of the tree since the root is its left child
+inline size_t avl_rank (const avl_node_base* node)
+{
+    size_t rank = node->left ? node->left->size : 0;
+    for (; node->parent != node->parent->parent; node = node->parent) {
+        if (node == node->parent->right)
+            rank += (node->parent->left ? node->parent->left->size : 0) + 1;
+    }
+    return rank;
+}
+
+/* TRAVERSAL */
+// inorder successor & predecessor, the header ends the walk in both
+// directions. NodePointer is a pointer to avl_node_base, const or not
+template <class NodePointer>
+NodePointer avl_next (NodePointer node)
+{
+    NodePointer parent = node->parent;
+    if (node->right) {
+        node = node->right;
+        while (node->left)
+            node = node->left;
+    } else if (node == parent->left) {
+        node = parent;
+    } else {
+        while (node == parent->right) {
+            node = parent;
+            parent = node->parent;
+        }
+        node = node->parent;
+    }
+    return node;
+}
+
+template <class NodePointer>
+NodePointer avl_prev (NodePointer node)
+{
+    NodePointer parent = node->parent;
+    if (node->left) {
+        node = node->left;
+        while (node->right)
+            node = node->right;
+    } else if (node == parent->right) {
+        node = parent;
+    } else {
+        while (node == parent->left) {
+            node = parent;
+            parent = node->parent;
+        }
+        node = node->parent;
+    }
+    return node;
+}
+
+/* STRUCTURE */
+// the functions below only rewrite links, heights & sizes so that the
+// trees owning their nodes & the intrusive ones share them. root has no
+// parent: a tree detaches it from its header while it is modified
+inline size_t avl_size (const avl_node_base* node)
+{
+    return node ? node->size : 0;
+}
+
+inline avl_node_base* avl_min (avl_node_base* node)
+{
+    while (node->left)
+        node = node->left;
+    return node;
+}
+
+inline avl_node_base* avl_max (avl_node_base* node)
+{
+    while (node->right)
+        node = node->right;
+    return node;
+}
+
+// refreshes the height & the subtree size, both only depend on the children
+inline void avl_update (avl_node_base* node)
+{
+    int lheight = node->left ? node->left->height : -1;
+    int rheight = node->right ? node->right->height : -1;
+    node->height = ft::max(lheight, rheight) + 1;
+    node->size = avl_size(node->left) + avl_size(node->right) + 1;
+}
+
+inline int avl_balance_factor (const avl_node_base* node)
+{
+    int lheight = node->left ? node->left->height : -1;
+    int rheight = node->right ? node->right->height : -1;
+    return rheight - lheight;
+}
+
+// makes child take the place of node below its parent
+inline void avl_replace_child (avl_node_base* node, avl_node_base* child, avl_node_base*& root)
+{
+    if (!node->parent)
+        root = child;
+    else if (node->parent->left == node)
+        node->parent->left = child;
+    else
+        node->parent->right = child;
+}
+
+inline avl_node_base* avl_rotate_left (avl_node_base* node, avl_node_base*& root)
+{
+    avl_node_base* tmp = node->right;
+    node->right = tmp->left;
+    node->right ? node->right->parent = node : 0;
+    tmp->left = node;
+    tmp->parent = node->parent;
+    avl_replace_child(node, tmp, root);
+    node->parent = tmp;
+    avl_update(node);
+    avl_update(tmp);
+    return tmp;
+}
+
+inline avl_node_base* avl_rotate_right (avl_node_base* node, avl_node_base*& root)
+{
+    avl_node_base* tmp = node->left;
+    node->left = tmp->right;
+    node->left ? node->left->parent = node : 0;
+    tmp->right = node;
+    tmp->parent = node->parent;
+    avl_replace_child(node, tmp, root);
+    node->parent = tmp;
+    avl_update(node);
+    avl_update(tmp);
+    return tmp;
+}
+
+// walks up to the root since every ancestor's size changes even when a
+// rotation already restored the heights
+inline void avl_rebalance (avl_node_base* node, avl_node_base*& root)
+{
+    for (; node; node = node->parent) {
+        int bf = avl_balance_factor(node);
+        if (bf == 2) {
+            if (avl_balance_factor(node->right) < 0)
+                avl_rotate_right(node->right, root);
+            node = avl_rotate_left(node, root);
+        } else if (bf == -2) {
+            if (avl_balance_factor(node->left) > 0)
+                avl_rotate_left(node->left, root);
+            node = avl_rotate_right(node, root);
+        } else {
+            avl_update(node);
+        }
+    }
+}
+
+// links a detached node at *link below parent & rebalances the tree, link
+// is either &root or one of the empty child links of parent
+inline void avl_link (avl_node_base* node, avl_node_base* parent, avl_node_base** link, avl_node_base*& root)
+{
+    node->height = 0;
+    node->size = 1;
+    node->left = NULL;
+    node->right = NULL;
+    node->parent = parent;
+    *link = node;
+    avl_rebalance(node, root);
+}
+
+// only works in the context of swapping a node with its inorder
+// successor during the erasal of a node with two children
+inline void avl_swap_with_successor (avl_node_base* n1, avl_node_base* n2, avl_node_base*& root)
+{
+    ft::swap(n1->height, n2->height);
+    ft::swap(n1->size, n2->size);
+
+    // swap left children
+    n2->left = n1->left;
+    n2->left->parent = n2;
+    n1->left = NULL;
+
+    // swap right children
+    avl_node_base* tmp = n2->right;
+    if (n1->right != n2) {
+        n2->right = n1->right;
+        n2->right->parent = n2;
+    } else {
+        // n1->parent will be fixed later
+        n2->right = n1;
+    }
+    n1->right = tmp;
+    n1->right ? n1->right->parent = n1 : 0;
+
+    // swap parents
+    avl_replace_child(n1, n2, root);
+    tmp = n2->parent;
+    n2->parent = n1->parent;
+    if (tmp == n1)
+        n1->parent = n2;
+    else {
+        n1->parent = tmp;
+        n1->parent->left = n1;
+    }
+}
+
+// unlinks node & rebalances the tree, the node itself is left as is for
+// its owner to release or reuse
+inline void avl_erase (avl_node_base* node, avl_node_base*& root)
+{
+    if (node->left && node->right)
+        avl_swap_with_successor(node, avl_min(node->right), root);
+    // node has one child at most now
+    avl_node_base* child = node->left ? node->left : node->right;
+    avl_node_base* parent = node->parent;
+    avl_replace_child(node, child, root);
+    child ? child->parent = parent : 0;
+    avl_rebalance(parent, root);
+}
+
 } // NAMESPACE FT
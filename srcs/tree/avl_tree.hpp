@@ -10,16 +10,19 @@
 #include <memory> // std::allocator
 #include <functional> // std::less
 #include <limits> // std::numeric_limits
+#include <utility> // std::pair
 
 namespace ft {
 
 template <class T,
           class Compare = std::less<T>,
-          class Alloc = std::allocator<T>
+          class Alloc = std::allocator<T>,
+          class KeyOfValue = ft::identity<T>
           >
 class avl_tree
 {
     public:
+        typedef typename KeyOfValue::key_type key_type;
         typedef T value_type;
         typedef avl_iterator<T, false> iterator;
         typedef avl_iterator<T, true> const_iterator;
@@ -33,52 +36,86 @@ class avl_tree
     private:
         typedef avl_node<value_type> node;
         typedef node * node_pointer;
+        typedef avl_node_base * base_pointer;
         typedef typename Alloc::template rebind<node>::other node_allocator;
 
     public:
         /* CONSTRUCTORS */
         explicit avl_tree (const compare& comp = compare(), const allocator_type& alloc = allocator_type())
-            : _root(NULL), _begin(new_node()), _end(new_node()), _added_node_ptr(NULL),
-              _added_node(false), _size(0), _alloc(alloc), _comp(comp)
+            : _alloc(alloc), _comp(comp), _root(NULL),
+              _added_node_ptr(NULL), _added_node(false), _size(0)
         {
-            _begin->parent = _end;
-            _end->parent = _begin;
+            initialize_header();
         }
 
         template <class InputIterator>
         avl_tree (InputIterator first, InputIterator last, const compare& comp = compare(), const allocator_type& alloc = allocator_type(),
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
-            : _root(NULL), _begin(new_node()), _end(new_node()), _added_node_ptr(NULL),
-              _added_node(false), _size(0), _alloc(alloc), _comp(comp)
+            : _alloc(alloc), _comp(comp), _root(NULL),
+              _added_node_ptr(NULL), _added_node(false), _size(0)
         {
+            initialize_header();
             insert(first, last);
         }
 
+        // the caller guarantees that [first, last) is sorted w/o duplicates
+        template <class InputIterator>
+        static avl_tree from_sorted (InputIterator first, InputIterator last, const compare& comp = compare(), const allocator_type& alloc = allocator_type())
+        {
+            avl_tree tree (comp, alloc);
+            tree.aux_build_sorted(first, last, false, false);
+            return tree;
+        }
+
         avl_tree (const avl_tree& x)
+            : _alloc(x._alloc), _comp(x._comp), _root(NULL),
+              _added_node_ptr(NULL), _added_node(false), _size(0)
+        {
+            initialize_header();
+            aux_copy(x);
+        }
+
+#ifdef FT_HAS_CXX11
+        // x is left empty
+        avl_tree (avl_tree&& x)
+            : _alloc(x._alloc), _comp(x._comp), _root(NULL),
+              _added_node_ptr(NULL), _added_node(false), _size(0)
         {
-            *this = x;
+            initialize_header();
+            swap(x);
         }
+#endif
 
         /* DESTRUCTOR */
         ~avl_tree()
         {
             clear();
-            delete_node(_begin);
-            delete_node(_end);
         }
 
         /* OPERATORS */
+        // the allocator is not propagated, the nodes already owned are
+        // reused for the copy
         avl_tree& operator= (const avl_tree& x)
         {
             if (this != &x) {
-                insert(x.begin(), x.end());
-                _alloc = x._alloc;
                 _comp = x._comp;
+                aux_copy(x);
             }
             return *this;
         }
 
-        friend bool operator== (const avl_tree<T, Compare, Alloc>& lhs, const avl_tree<T, Compare, Alloc>& rhs)
+#ifdef FT_HAS_CXX11
+        avl_tree& operator= (avl_tree&& x)
+        {
+            if (this != &x) {
+                clear();
+                swap(x);
+            }
+            return *this;
+        }
+#endif
+
+        friend bool operator== (const avl_tree& lhs, const avl_tree& rhs)
         {
             if (lhs._size != rhs._size)
                 return false;
@@ -93,7 +130,7 @@ class avl_tree
             return true;
         }
 
-        friend bool operator< (const avl_tree<T, Compare, Alloc>& lhs, const avl_tree<T, Compare, Alloc>& rhs)
+        friend bool operator< (const avl_tree& lhs, const avl_tree& rhs)
         {
             const_iterator lit = lhs.begin();
             const_iterator rit = rhs.begin();
@@ -110,10 +147,10 @@ class avl_tree
             return true;
         }
 
-        friend bool operator!= (const avl_tree<T, Compare, Alloc>& lhs, const avl_tree<T, Compare, Alloc>& rhs) { return !(lhs == rhs); }
-        friend bool operator<= (const avl_tree<T, Compare, Alloc>& lhs, const avl_tree<T, Compare, Alloc>& rhs) { return !(rhs < lhs); }
-        friend bool operator> (const avl_tree<T, Compare, Alloc>& lhs, const avl_tree<T, Compare, Alloc>& rhs) { return rhs < lhs; }
-        friend bool operator>= (const avl_tree<T, Compare, Alloc>& lhs, const avl_tree<T, Compare, Alloc>& rhs) { return !(lhs < rhs); }
+        friend bool operator!= (const avl_tree& lhs, const avl_tree& rhs) { return !(lhs == rhs); }
+        friend bool operator<= (const avl_tree& lhs, const avl_tree& rhs) { return !(rhs < lhs); }
+        friend bool operator> (const avl_tree& lhs, const avl_tree& rhs) { return rhs < lhs; }
+        friend bool operator>= (const avl_tree& lhs, const avl_tree& rhs) { return !(lhs < rhs); }
 
         /* MODIFIERS */
         // TODO: add check if arg is greater than max or lesser than min and use as hint
@@ -129,10 +166,10 @@ class avl_tree
 
         iterator insert (iterator position, const value_type& val)
         {
-            if (position != end() && _comp(*position, val)) {
+            if (position != end() && _comp(key_of(*position), key_of(val))) {
                 iterator next = position;
                 ++next;
-                if (next == end() || _comp(val, *next)) {
+                if (next == end() || _comp(key_of(val), key_of(*next))) {
                     unset_bounds();
                     aux_insert(position.get_node()->parent, position.get_node(), val);
                     // do not need to check if node was inserted since
@@ -149,28 +186,42 @@ class avl_tree
         void insert (InputIterator first, InputIterator last,
               typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
         {
+            if (empty())
+                first = aux_build_sorted(first, last, false, true);
             for (; first != last; ++first)
                 insert(*first);
         }
 
+#ifdef FT_HAS_CXX11
+        std::pair<iterator, bool> insert (value_type&& val) { return emplace(std::move(val)); }
+        iterator insert (iterator position, value_type&& val) { return emplace_hint(position, std::move(val)); }
+
+        // the node is built from args before its position is looked up
+        // and released again if its key is already present
+        template <class... Args>
+        std::pair<iterator, bool> emplace (Args&&... args)
+        {
+            return aux_link(_root, new_node(in_place_t(), std::forward<Args>(args)...), false);
+        }
+
+        template <class... Args>
+        iterator emplace_hint (iterator position, Args&&... args)
+        {
+            node_pointer node = new_node(in_place_t(), std::forward<Args>(args)...);
+            return aux_link(aux_hint(position, node), node, false).first;
+        }
+#endif
+
         void erase (iterator position)
         {
             --_size;
             unset_bounds();
-            node_pointer node = position.get_node();
-            node_pointer tmp;
-            if (!node->left && !node->right)
-                tmp = aux_erase_no_child_node(node);
-            else if ((!node->left && node->right) || (node->left && !node->right))
-                tmp = aux_erase_one_child_node(node);
-            else
-                tmp = aux_erase_two_child_node(node);
-            recompute_heights(tmp);
-            rebalance(tmp);
+            avl_erase(position.get_node(), _root);
+            delete_node(position.get_node());
             set_bounds();
         }
 
-        size_type erase (const value_type& k)
+        size_type erase (const key_type& k)
         {
             size_type old_size = _size;
             iterator it = find(k);
@@ -188,14 +239,15 @@ class avl_tree
         }
 
         /* ELEMENT ACCESS */
-        iterator begin() { return iterator(_begin->parent); }
-        const_iterator begin() const { return const_iterator(_begin->parent); }
-        iterator end() { return iterator(_end); }
-        const_iterator end() const { return const_iterator(_end); }
-        reverse_iterator rbegin() { return reverse_iterator(_end->parent); }
-        const_reverse_iterator rbegin() const { return const_reverse_iterator(_end->parent); }
-        reverse_iterator rend() { return reverse_iterator(_begin); }
-        const_reverse_iterator rend() const { return const_reverse_iterator(_begin); }
+        // the header ends the traversal in both directions
+        iterator begin() { return iterator(_header.right); }
+        const_iterator begin() const { return const_iterator(_header.right); }
+        iterator end() { return iterator(header()); }
+        const_iterator end() const { return const_iterator(header()); }
+        reverse_iterator rbegin() { return reverse_iterator(_root ? avl_max(_root) : header()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(_root ? avl_max(_root) : header()); }
+        reverse_iterator rend() { return reverse_iterator(header()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(header()); }
 
         /* CAPACITY */
         size_type size (void) const { return _size; }
@@ -203,15 +255,19 @@ class avl_tree
         size_type max_size (void) const { return _alloc.max_size(); }
 
         /* MODIFIERS */
+        // the headers stay in place, only the roots & the min nodes are
+        // relinked to their new header
         void swap (avl_tree& x)
         {
+            ft::swap(_comp, x._comp);
             ft::swap(_root, x._root);
-            ft::swap(_begin, x._begin);
-            ft::swap(_end, x._end);
+            ft::swap(_header.right, x._header.right);
             ft::swap(_size, x._size);
             ft::swap(_alloc, x._alloc);
             ft::swap(_added_node_ptr, x._added_node_ptr);
             ft::swap(_added_node, x._added_node);
+            attach_root();
+            x.attach_root();
         }
 
         void clear (void)
@@ -223,110 +279,83 @@ class avl_tree
             set_bounds();
         }
 
-        /* OBSERVERS */
-        size_type count (const value_type& val) const
+        /* OPERATIONS */
+        size_type count (const key_type& k) const
         {
-            if (find(val) != end())
+            if (find(k) != end())
                 return 1;
             return 0;
         }
 
-        iterator find (const value_type& val)
-        {
-            node_pointer node = _root;
-            while (node && node != _begin && node != _end) {
-                if (_comp(node->content, val))
-                    node = node->right;
-                else if (_comp(val, node->content))
-                    node = node->left;
-                else
-                    return iterator(node);
-            }
-            return end();
-        }
-
-        const_iterator find (const value_type& val) const
-        {
-            node_pointer node = _root;
-            while (node && node != _begin && node != _end) {
-                if (_comp(node->content, val))
-                    node = node->right;
-                else if (_comp(val, node->content))
-                    node = node->left;
-                else
-                    return const_iterator(node);
-            }
-            return end();
-        }
-
-        std::pair<iterator, iterator> equal_range (const value_type& val)
-        {
-            iterator low = lower_bound(val);
-            iterator up = upper_bound(val);
-            return std::make_pair(low, up);
-        }
-
-        std::pair<const_iterator, const_iterator> equal_range (const value_type& val) const
-        {
-            const_iterator low = lower_bound(val);
-            const_iterator up = upper_bound(val);
-            return std::make_pair(low, up);
-        }
+        iterator find (const key_type& k) { return iterator(aux_find(k)); }
+        const_iterator find (const key_type& k) const { return const_iterator(aux_find(k)); }
 
         // lower_bound returns iterator to first element that is not less than k
         // upper_bound returns iterator to first element that is greater than k
-        iterator lower_bound (const value_type& val)
+        iterator lower_bound (const key_type& k) { return iterator(aux_lower_bound(_root, k, header())); }
+        const_iterator lower_bound (const key_type& k) const { return const_iterator(aux_lower_bound(_root, k, header())); }
+        iterator upper_bound (const key_type& k) { return iterator(aux_upper_bound(_root, k, header())); }
+        const_iterator upper_bound (const key_type& k) const { return const_iterator(aux_upper_bound(_root, k, header())); }
+
+        std::pair<iterator, iterator> equal_range (const key_type& k)
         {
-            iterator ite = end();
-            for (iterator it = begin(); it != ite; ++it) {
-                if (!_comp(*it, val))
-                    return it;
-            }
-            return ite;
+            std::pair<base_pointer, base_pointer> range = aux_equal_range(k);
+            return std::make_pair(iterator(range.first), iterator(range.second));
         }
 
-        const_iterator lower_bound (const value_type& val) const
+        std::pair<const_iterator, const_iterator> equal_range (const key_type& k) const
         {
-            const_iterator ite = end();
-            for (const_iterator it = begin(); it != ite; ++it) {
-                if (!_comp(*it, val))
-                    return it;
-            }
-            return ite;
+            std::pair<base_pointer, base_pointer> range = aux_equal_range(k);
+            return std::make_pair(const_iterator(range.first), const_iterator(range.second));
         }
 
-        iterator upper_bound (const value_type& val)
+        /* ORDER STATISTICS */
+        // rank returns the number of elements less than k
+        // select returns an iterator to the element of rank n
+        // count_range returns the number of elements in [lo, hi)
+        size_type rank (const key_type& k) const
         {
-            iterator ite = end();
-            for (iterator it = begin(); it != ite; ++it) {
-                if (_comp(val, *it))
-                    return it;
+            size_type rank = 0;
+            base_pointer node = _root;
+            while (node) {
+                if (_comp(key_of(node), k)) {
+                    rank += avl_size(node->left) + 1;
+                    node = node->right;
+                } else {
+                    node = node->left;
+                }
             }
-            return ite;
+            return rank;
         }
 
-        const_iterator upper_bound (const value_type& val) const
+        iterator select (size_type n) { return iterator(aux_select(n)); }
+        const_iterator select (size_type n) const { return const_iterator(aux_select(n)); }
+
+        size_type count_range (const key_type& lo, const key_type& hi) const
         {
-            const_iterator ite = end();
-            for (const_iterator it = begin(); it != ite; ++it) {
-                if (_comp(val, *it))
-                    return it;
-            }
-            return ite;
+            size_type lo_rank = rank(lo);
+            size_type hi_rank = rank(hi);
+            return hi_rank > lo_rank ? hi_rank - lo_rank : 0;
         }
 
     protected:
-        node_pointer _root;
-        node_pointer _begin;
-        node_pointer _end;
-        node_pointer _added_node_ptr;
-        bool _added_node;
-        size_type _size;
         node_allocator _alloc;
         compare _comp;
+        base_pointer _root;
+        // holds no value, it is not allocated
+        avl_node_base _header;
+        base_pointer _added_node_ptr;
+        bool _added_node;
+        size_type _size;
+
+        static const key_type& key_of (const value_type& val) { return KeyOfValue()(val); }
+        static const key_type& key_of (base_pointer node) { return key_of(value_of(node)); }
+        static value_type& value_of (base_pointer node) { return static_cast<node_pointer>(node)->content; }
+
+        base_pointer header (void) const { return const_cast<base_pointer>(&_header); }
 
         /* INSERT */
-        node_pointer aux_insert (node_pointer parent, node_pointer node, const value_type& val)
+        base_pointer aux_insert (base_pointer parent, base_pointer node, const value_type& val)
         {
             if (!node) {
                 node = new_node(val);
@@ -334,9 +363,9 @@ class avl_tree
                 _added_node = true;
                 _added_node_ptr = node;
                 ++_size;
-            } else if (_comp(val, node->content)) {
+            } else if (_comp(key_of(val), key_of(node))) {
                 node->left = aux_insert(node, node->left, val);
-            } else if (_comp(node->content, val)) {
+            } else if (_comp(key_of(node), key_of(val))) {
                 node->right = aux_insert(node, node->right, val);
             } else {
                 _added_node = false;
@@ -345,206 +374,315 @@ class avl_tree
             return node;
         }
 
-        /* ERASE */
-        node_pointer aux_erase_no_child_node (node_pointer child)
+        // links a detached node below start, equal keys are linked to the
+        // right when multi is set, otherwise the node is released and the
+        // element already holding its key is returned
+        std::pair<iterator, bool> aux_link (base_pointer start, node_pointer node, bool multi)
         {
-            node_pointer parent = child->parent;
-            if (parent) {
-                if (parent->left == child)
-                    parent->left = NULL;
-                else
-                    parent->right = NULL;
-            } else {
-                _root = NULL;
+            unset_bounds();
+            base_pointer parent = start ? start->parent : NULL;
+            base_pointer * link = &_root;
+            if (parent)
+                link = parent->left == start ? &parent->left : &parent->right;
+            while (*link) {
+                parent = *link;
+                if (_comp(key_of(node->content), key_of(parent))) {
+                    link = &parent->left;
+                } else if (multi || _comp(key_of(parent), key_of(node->content))) {
+                    link = &parent->right;
+                } else {
+                    set_bounds();
+                    delete_node(node);
+                    return std::make_pair(iterator(parent), false);
+                }
             }
-            delete_node(child);
-            return parent;
+            avl_link(node, parent, link, _root);
+            ++_size;
+            set_bounds();
+            return std::make_pair(iterator(node), true);
         }
 
-        node_pointer aux_erase_one_child_node (node_pointer child)
+        // returns the subtree in which val can be linked when it belongs
+        // between position & its successor, the root otherwise
+        base_pointer aux_hint (iterator position, node_pointer node)
         {
-            node_pointer parent = child->parent;
-            if (parent) {
-                if (parent->left == child)
-                    parent->left = (child->left ? child->left : child->right);
-                else if (parent->right == child)
-                    parent->right = (child->left ? child->left : child->right);
-            } else {
-                _root = (child->left ? child->left : child->right);
+            if (position != end() && _comp(key_of(*position), key_of(node->content))) {
+                iterator next = position;
+                ++next;
+                if (next == end() || _comp(key_of(node->content), key_of(*next)))
+                    return position.get_node();
             }
-            if (child->left)
-                child->left->parent = parent;
-            else
-                child->right->parent = parent;
-            delete_node(child);
-            return parent;
+            return _root;
         }
 
-        node_pointer aux_erase_two_child_node (node_pointer child)
+        // deletes the nodes linked by their right pointers from head when
+        // it goes out of scope, a caller keeps them by resetting head
+        struct node_chain
         {
-            node_pointer min = get_min(child->right);
-            swap_nodes(child, min);
-            if (!child->left && !child->right)
-                return aux_erase_no_child_node(child);
-            return aux_erase_one_child_node(child);
-        }
+            avl_tree& tree;
+            base_pointer head;
 
-        /* REBALANCING */
+            node_chain (avl_tree& t, base_pointer first)
+                : tree(t), head(first)
+            {
+            }
 
-        // TODO: use bf instead of height and break when
-        // deletion/insertion has been balanced out
-        void rebalance (node_pointer node)
-        {
-            for (; node; node = node->parent) {
-                int lheight = (node->left) ? node->left->height : -1;
-                int rheight = (node->right) ? node->right->height : -1;
-                int bf = rheight - lheight;
-                if (bf == 2) {
-                    if (!node->right->right)
-                        node->right = right_rotate(node->right);
-                    node = left_rotate(node);
-                    break ;
-                } else if (bf == -2) {
-                    if (!node->left->left)
-                        node->left = left_rotate(node->left);
-                    node = right_rotate(node);
-                    break ;
-                } else {
-                    update_height(node);
+            ~node_chain()
+            {
+                while (head) {
+                    base_pointer next = head->right;
+                    tree.delete_node(head);
+                    head = next;
                 }
             }
+        };
+
+        /* BULK CONSTRUCTION */
+        // links the longest sorted prefix of [first, last) into a chain using
+        // the right pointers and turns it into a perfectly balanced tree in
+        // O(n), duplicates are dropped unless multi is set, the tree has to be
+        // empty, returns an iterator to the first element which was not used
+        template <class InputIterator>
+        InputIterator aux_build_sorted (InputIterator first, InputIterator last, bool multi, bool check)
+        {
+            // the chain is freed if copying an element throws
+            node_chain chain (*this, NULL);
+            base_pointer tail = NULL;
+            size_type n = 0;
+            for (; first != last; ++first) {
+                if (check && tail) {
+                    if (_comp(key_of(*first), key_of(tail)))
+                        break ;
+                    if (!multi && !_comp(key_of(tail), key_of(*first)))
+                        continue ;
+                }
+                base_pointer node = new_node(*first);
+                if (tail)
+                    tail->right = node;
+                else
+                    chain.head = node;
+                tail = node;
+                ++n;
+            }
+            if (n != 0) {
+                base_pointer head = chain.head;
+                chain.head = NULL;
+                _root = aux_build(head, n, NULL);
+                _size = n;
+                set_bounds();
+            }
+            return first;
+        }
+
+        // the left half is built first so that the chain is consumed in order
+        base_pointer aux_build (base_pointer& chain, size_type n, base_pointer parent)
+        {
+            if (n == 0)
+                return NULL;
+            base_pointer left = aux_build(chain, n / 2, NULL);
+            base_pointer node = chain;
+            chain = chain->right;
+            node->parent = parent;
+            node->left = left;
+            left ? left->parent = node : 0;
+            node->right = aux_build(chain, n - n / 2 - 1, node);
+            avl_update(node);
+            return node;
         }
 
-        int get_height (node_pointer node)
+        /* COPY */
+        // clones x node for node, heights & sizes included, taking the
+        // storage from the nodes of this tree before allocating new ones.
+        // the clone is linked under _root as it is built so that it can be
+        // cleared if copying a value throws, the tree is then left empty
+        void aux_copy (const avl_tree& x)
         {
-            if (!node)
-                return 0;
-            int left_height = get_height(node->left);
-            int right_height = get_height(node->right);
-            return ft::max(left_height, right_height) + 1;
+            unset_bounds();
+            node_chain spare (*this, aux_flatten(_root, NULL));
+            _root = NULL;
+            _size = 0;
+            copy_guard guard = { *this, false };
+            aux_clone(x._root, NULL, _root, spare);
+            _size = x._size;
+            guard.done = true;
         }
 
-        void update_height(node_pointer node)
+        // clears the part of the clone built when it goes out of scope
+        // before the copy is done
+        struct copy_guard
         {
-            int lheight = node->left ? node->left->height : -1;
-            int rheight = node->right ? node->right->height : -1;
-            node->height = ft::max(lheight, rheight) + 1;
-        }
+            avl_tree& tree;
+            bool done;
+
+            ~copy_guard()
+            {
+                if (!done) {
+                    tree.aux_clear(tree._root);
+                    tree._root = NULL;
+                }
+                tree.set_bounds();
+            }
+        };
 
-        void recompute_heights(node_pointer node)
+        // chains every node of the subtree using the right pointers
+        base_pointer aux_flatten (base_pointer node, base_pointer chain)
         {
             if (!node)
+                return chain;
+            chain = aux_flatten(node->left, chain);
+            chain = aux_flatten(node->right, chain);
+            node->right = chain;
+            return node;
+        }
+
+        // a spare node leaves the chain before its value is destroyed, its
+        // storage is freed if the new value cannot be copied into it
+        void aux_clone (base_pointer src, base_pointer parent, base_pointer& link, node_chain& spare)
+        {
+            if (!src)
                 return ;
-            update_height(node);
-            recompute_heights(node->parent);
-        }
-
-        /* ROTATIONS */
-        node_pointer left_rotate (node_pointer node)
-        {
-            node_pointer tmp = node->right;
-            node->right = tmp->left;
-            node->right ? node->right->parent = node : 0;
-            tmp->left = node;
-            tmp->parent = node->parent;
-            if (!node->parent)
-                _root = tmp;
-            else if (node->parent->left == node)
-                node->parent->left = tmp;
-            else
-                node->parent->right = tmp;
-            node->parent = tmp;
-            update_height(tmp->left);
-            update_height(tmp);
-            return tmp;
-        }
-
-        node_pointer right_rotate (node_pointer node)
-        {
-            node_pointer tmp = node->left;
-            node->left = tmp->right;
-            node->left ? node->left->parent = node : 0;
-            tmp->right = node;
-            tmp->parent = node->parent;
-            if (!node->parent)
-                _root = tmp;
-            else if (node->parent->left == node)
-                node->parent->left = tmp;
-            else
-                node->parent->right = tmp;
-            node->parent = tmp;
-            update_height(tmp->right);
-            update_height(tmp);
-            return tmp;
-        }
-
-        /* UTILITIES */
-        // only works in the context of swapping a node with it's
-        // inorder successor during the erasal of a node with
-        // two children
-        void swap_nodes (node_pointer n1, node_pointer n2)
-        {
-            ft::swap(n1->height, n2->height);
-
-            // swap left children
-            n2->left = n1->left;
-            n2->left->parent = n2;
-            n1->left = NULL;
-
-            // swap right children
-            node_pointer tmp = n2->right;
-            if (n1->right != n2) {
-                n2->right = n1->right;
-                n2->right->parent = n2;
+            node_pointer node;
+            if (spare.head) {
+                node_holder holder = { _alloc, static_cast<node_pointer>(spare.head) };
+                spare.head = spare.head->right;
+                _alloc.destroy(holder.node);
+                _alloc.construct(holder.node, value_of(src));
+                node = holder.node;
+                holder.node = NULL;
             } else {
-                // n1->parent will be fixed later
-                n2->right = n1;
+                node = new_node(value_of(src));
             }
-            n1->right = tmp;
-            n1->right ? n1->right->parent = n1 : 0;
-
-            // swap parents
-            if (n1->parent == NULL)
-                _root = n2;
-            else if (n1->parent->left == n1)
-                n1->parent->left = n2;
-            else
-                n1->parent->right = n2;
-
-            tmp = n2->parent;
-            n2->parent = n1->parent;
-            if (tmp == n1)
-                n1->parent = n2;
-            else {
-                n1->parent = tmp;
-                n1->parent->left = n1;
+            node->height = src->height;
+            node->size = src->size;
+            node->parent = parent;
+            node->left = NULL;
+            node->right = NULL;
+            link = node;
+            aux_clone(src->left, node, node->left, spare);
+            aux_clone(src->right, node, node->right, spare);
+        }
+
+        /* LOOKUP */
+        base_pointer aux_find (const key_type& k) const
+        {
+            base_pointer node = _root;
+            while (node) {
+                if (_comp(key_of(node), k))
+                    node = node->right;
+                else if (_comp(k, key_of(node)))
+                    node = node->left;
+                else
+                    return node;
+            }
+            return header();
+        }
+
+        // every node which is not less than k is a candidate, the last
+        // candidate seen on the way down is the leftmost one
+        base_pointer aux_lower_bound (base_pointer node, const key_type& k, base_pointer bound) const
+        {
+            while (node) {
+                if (!_comp(key_of(node), k)) {
+                    bound = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
             }
+            return bound;
         }
 
+        base_pointer aux_upper_bound (base_pointer node, const key_type& k, base_pointer bound) const
+        {
+            while (node) {
+                if (_comp(k, key_of(node))) {
+                    bound = node;
+                    node = node->left;
+                } else {
+                    node = node->right;
+                }
+            }
+            return bound;
+        }
+
+        // walk down until a node equal to k splits the search, the lower bound
+        // is then in its left subtree and the upper bound in its right subtree
+        std::pair<base_pointer, base_pointer> aux_equal_range (const key_type& k) const
+        {
+            base_pointer node = _root;
+            base_pointer up = header();
+            while (node) {
+                if (_comp(key_of(node), k)) {
+                    node = node->right;
+                } else if (_comp(k, key_of(node))) {
+                    up = node;
+                    node = node->left;
+                } else {
+                    return std::make_pair(aux_lower_bound(node->left, k, node),
+                                          aux_upper_bound(node->right, k, up));
+                }
+            }
+            return std::make_pair(up, up);
+        }
+
+        base_pointer aux_select (size_type n) const
+        {
+            if (n >= _size)
+                return header();
+            base_pointer node = _root;
+            for (;;) {
+                size_type left_size = avl_size(node->left);
+                if (n < left_size) {
+                    node = node->left;
+                } else if (n > left_size) {
+                    n -= left_size + 1;
+                    node = node->right;
+                } else {
+                    return node;
+                }
+            }
+        }
+
+        /* REBALANCING */
+        void rebalance (base_pointer node)
+        {
+            avl_rebalance(node, _root);
+        }
+
+        /* HEADER */
+        // the header is its own parent & points to itself as the min node
+        // of an empty tree, so begin() == end()
+        void initialize_header (void)
+        {
+            _header.size = 0;
+            _header.parent = &_header;
+            _header.right = &_header;
+        }
+
+        // the root is detached from the header while the tree is modified,
+        // the algorithms below expect a root without parent
         void unset_bounds (void)
         {
-            if (_begin->parent && _begin->parent != _end)
-                _begin->parent->left = NULL;
-            if (_end->parent && _end->parent != _begin)
-                _end->parent->right = NULL;
+            if (_root)
+                _root->parent = NULL;
         }
 
         void set_bounds (void)
         {
-            if (_size != 0) {
-                node_pointer min = get_min(_root);
-                node_pointer max = get_max(_root);
-                _begin->parent = min;
-                min->left = _begin;
-                _end->parent = max;
-                max->right = _end;
-            } else {
-                _begin->parent = _end;
-                _end->parent = _begin;
-            }
+            _header.right = _root ? avl_min(_root) : &_header;
+            attach_root();
         }
 
-        void aux_clear (node_pointer node)
+        void attach_root (void)
+        {
+            _header.left = _root;
+            if (_root)
+                _root->parent = &_header;
+            else
+                _header.right = &_header;
+        }
+
+        void aux_clear (base_pointer node)
         {
             if (!node)
                 return ;
@@ -553,39 +691,54 @@ class avl_tree
             delete_node(node);
         }
 
-        node_pointer get_min (node_pointer node)
+        /* MEMORY MANAGEMENT */
+        // gives the storage of a node back to the allocator if building
+        // its value throws, a caller keeps it by resetting node
+        struct node_holder
         {
-            while (node->left)
-                node = node->left;
-            return node;
-        }
+            node_allocator& alloc;
+            node_pointer node;
 
-        node_pointer get_max (node_pointer node)
+            ~node_holder()
+            {
+                if (node)
+                    alloc.deallocate(node, 1);
+            }
+        };
+
+        node_pointer new_node (const value_type& val)
         {
-            while (node->right)
-                node = node->right;
-            return node;
+            node_holder holder = { _alloc, _alloc.allocate(1) };
+            // implicitly calls avl_node constructor to create tmp node
+            _alloc.construct(holder.node, val);
+            node_pointer p = holder.node;
+            holder.node = NULL;
+            return p;
         }
 
-        /* MEMORY MANAGEMENT */
-        node_pointer new_node (const value_type& val = value_type())
+#ifdef FT_HAS_CXX11
+        template <class... Args>
+        node_pointer new_node (in_place_t, Args&&... args)
         {
-            node_pointer p = _alloc.allocate(1);
-            // implicitly calls avl_node constructor to create tmp node
-            _alloc.construct(p, val);
+            node_holder holder = { _alloc, _alloc.allocate(1) };
+            _alloc.construct(holder.node, in_place_t(), std::forward<Args>(args)...);
+            node_pointer p = holder.node;
+            holder.node = NULL;
             return p;
         }
+#endif
 
-        void delete_node (node_pointer p)
+        void delete_node (base_pointer p)
         {
-            _alloc.destroy(p);
-            _alloc.deallocate(p, 1);
+            node_pointer node = static_cast<node_pointer>(p);
+            _alloc.destroy(node);
+            _alloc.deallocate(node, 1);
         }
 
 }; // CLASS AVL_TREE
 
-template <class T, class Compare, class Alloc>
-void swap (avl_tree<T, Compare, Alloc>& x, avl_tree<T, Compare, Alloc>& y)
+template <class T, class Compare, class Alloc, class KeyOfValue>
+void swap (avl_tree<T, Compare, Alloc, KeyOfValue>& x, avl_tree<T, Compare, Alloc, KeyOfValue>& y)
 {
     x.swap(y);
 }
@@ -0,0 +1,900 @@
+#pragma once
+
+#include "unrolled_list_node.hpp"
+#include "unrolled_list_iterator.hpp"
+#include "../utils/utils.hpp" // ft::enable_if, ft::is_trivially_relocatable
+
+#include <cstddef> // NULL, std::ptrdiff_t, size_t
+#include <cstring> // std::memmove
+#include <climits> // CHAR_BIT
+
+#include <memory> // std::allocator
+#include <limits> // std::numeric_limits
+#include <functional> // std::equal_to, std::less
+#include <new> // placement new
+
+namespace ft {
+
+/* UNROLLED LIST */
+// list storing up to NodeCapacity elements in each node, a traversal pays
+// a cache miss per node instead of one per element. an insertion into a
+// full node splits it in halves, an erasure merges the node before the
+// erased elements with its successor when one of them is less than half
+// full & both fit in a single node
+//
+// unlike ft::list, the insertions & erasures invalidate the iterators to
+// the elements of the nodes they shift, split or merge, splice keeps the
+// elements in place but may split the nodes at its positions, merge &
+// sort relocate the elements & invalidate every iterator
+template < class T, size_t NodeCapacity = ft::unrolled_default_capacity<T>::value, class Alloc = std::allocator<T> >
+class unrolled_list
+{
+    private:
+        // a node holds 2 elements at least so that a split leaves none empty
+        static const size_t node_capacity = NodeCapacity > 2 ? NodeCapacity : 2;
+
+    public:
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef unrolled_list_iterator<value_type, node_capacity, false> iterator;
+        typedef unrolled_list_iterator<value_type, node_capacity, true> const_iterator;
+        typedef reverse_unrolled_list_iterator<value_type, node_capacity, false> reverse_iterator;
+        typedef reverse_unrolled_list_iterator<value_type, node_capacity, true> const_reverse_iterator;
+        typedef std::ptrdiff_t difference_type;
+        typedef size_t size_type;
+
+    private:
+        typedef unrolled_node<value_type, node_capacity> node;
+        typedef node* node_pointer;
+        typedef unrolled_node_base* base_pointer;
+        typedef typename Alloc::template rebind<node>::other node_allocator;
+
+        // nodes chained through next up to NULL, the list is cut into runs
+        // while merging & sorting
+        struct run
+        {
+            base_pointer first;
+            base_pointer last;
+        };
+
+    public:
+        /* CONSTRUCTORS */
+        explicit unrolled_list (const allocator_type& alloc = allocator_type())
+            : _alloc(alloc), _node_alloc(alloc), _size(0)
+        {
+            initialize_sentinel();
+        }
+
+        explicit unrolled_list (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
+            : _alloc(alloc), _node_alloc(alloc), _size(0)
+        {
+            initialize_sentinel();
+            assign(n, val);
+        }
+
+        template <class InputIterator>
+        unrolled_list (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+            : _alloc(alloc), _node_alloc(alloc), _size(0)
+        {
+            initialize_sentinel();
+            assign(first, last);
+        }
+
+        unrolled_list (const unrolled_list& x)
+            : _alloc(x._alloc), _node_alloc(x._node_alloc), _size(0)
+        {
+            initialize_sentinel();
+            *this = x;
+        }
+
+#ifdef FT_HAS_CXX11
+        // x is left empty
+        unrolled_list (unrolled_list&& x)
+            : _alloc(x._alloc), _node_alloc(x._node_alloc), _size(0)
+        {
+            initialize_sentinel();
+            swap(x);
+        }
+#endif
+
+        /* OPERATORS */
+        unrolled_list& operator= (const unrolled_list& x)
+        {
+            if (this != &x)
+                assign(x.begin(), x.end());
+            return *this;
+        }
+
+#ifdef FT_HAS_CXX11
+        unrolled_list& operator= (unrolled_list&& x)
+        {
+            if (this != &x) {
+                clear();
+                swap(x);
+            }
+            return *this;
+        }
+#endif
+
+        friend bool operator== (const unrolled_list& lhs, const unrolled_list& rhs)
+        {
+            if (lhs._size != rhs._size)
+                return false;
+            const_iterator lit = lhs.begin();
+            const_iterator rit = rhs.begin();
+            for (; lit != lhs.end(); ++lit, ++rit) {
+                if (*lit != *rit)
+                    return false;
+            }
+            return true;
+        }
+
+        friend bool operator< (const unrolled_list& lhs, const unrolled_list& rhs)
+        {
+            const_iterator lit = lhs.begin();
+            const_iterator rit = rhs.begin();
+            while (lit != lhs.end() && rit != rhs.end()) {
+                if (*lit < *rit)
+                    return true;
+                if (*lit > *rit)
+                    return false;
+                ++lit;
+                ++rit;
+            }
+            if (lhs._size >= rhs._size)
+                return false;
+            return true;
+        }
+
+        friend bool operator!= (const unrolled_list& lhs, const unrolled_list& rhs) { return !(lhs == rhs); }
+        friend bool operator<= (const unrolled_list& lhs, const unrolled_list& rhs) { return !(rhs < lhs); }
+        friend bool operator> (const unrolled_list& lhs, const unrolled_list& rhs) { return rhs < lhs; }
+        friend bool operator>= (const unrolled_list& lhs, const unrolled_list& rhs) { return !(lhs < rhs); }
+
+        /* DESTRUCTOR */
+        ~unrolled_list()
+        {
+            clear();
+        }
+
+        /* ITERATORS */
+        // the sentinel ends the ring in both directions
+        iterator begin() { return iterator(_sentinel.next, 0); }
+        const_iterator begin() const { return const_iterator(_sentinel.next, 0); }
+        iterator end() { return iterator(&_sentinel, 0); }
+        const_iterator end() const { return const_iterator(&_sentinel, 0); }
+        reverse_iterator rbegin() { return reverse_iterator(_sentinel.prev, last_index(_sentinel.prev)); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(_sentinel.prev, last_index(_sentinel.prev)); }
+        reverse_iterator rend() { return reverse_iterator(&_sentinel, 0); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(&_sentinel, 0); }
+
+        /* CAPACITY */
+        bool empty() const { return _size == 0; }
+        size_type size() const { return _size; }
+        size_type max_size() const { return _alloc.max_size(); }
+
+        // the number of elements a node can hold
+        size_type node_size() const { return node_capacity; }
+
+        /* ELEMENT ACCESS */
+        reference front (void) { return values_of(_sentinel.next)[0]; }
+        const_reference front (void) const { return values_of(_sentinel.next)[0]; }
+        reference back (void) { return values_of(_sentinel.prev)[_sentinel.prev->count - 1]; }
+        const_reference back (void) const { return values_of(_sentinel.prev)[_sentinel.prev->count - 1]; }
+
+        /* MODIFIERS */
+        template <class InputIterator>
+        void assign (InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+        {
+            clear();
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        void assign (size_type n, const value_type& val)
+        {
+            clear();
+            for (size_type i = 0; i < n; ++i)
+                push_back(val);
+        }
+
+        void push_front (const value_type& val)
+        {
+            insert(begin(), val);
+        }
+
+        void pop_front (void)
+        {
+            erase(begin());
+        }
+
+        // the elements are appended to the last node until it is full,
+        // nothing is shifted
+        void push_back (const value_type& val)
+        {
+            base_pointer last = back_node();
+            _alloc.construct(values_of(last) + last->count, val);
+            ++last->count;
+            ++_size;
+        }
+
+        void pop_back (void)
+        {
+            base_pointer last = _sentinel.prev;
+            _alloc.destroy(values_of(last) + last->count - 1);
+            --_size;
+            if (--last->count == 0)
+                delete_node(unlink_node(last));
+        }
+
+        iterator insert (iterator position, const value_type& val)
+        {
+            // val may refer to an element which is about to be shifted
+            value_type copy (val);
+            iterator slot = make_slot(position);
+#ifdef FT_HAS_CXX11
+            _alloc.construct(&*slot, std::move(copy));
+#else
+            _alloc.construct(&*slot, copy);
+#endif
+            return slot;
+        }
+
+#ifdef FT_HAS_CXX11
+        void push_front (value_type&& val) { emplace(begin(), std::move(val)); }
+        void push_back (value_type&& val) { emplace_back(std::move(val)); }
+        iterator insert (iterator position, value_type&& val) { return emplace(position, std::move(val)); }
+
+        template <class... Args>
+        void emplace_front (Args&&... args) { emplace(begin(), std::forward<Args>(args)...); }
+
+        template <class... Args>
+        void emplace_back (Args&&... args)
+        {
+            base_pointer last = back_node();
+            _alloc.construct(values_of(last) + last->count, std::forward<Args>(args)...);
+            ++last->count;
+            ++_size;
+        }
+
+        // args may refer to an element which is about to be shifted
+        template <class... Args>
+        iterator emplace (iterator position, Args&&... args)
+        {
+            value_type tmp (std::forward<Args>(args)...);
+            iterator slot = make_slot(position);
+            _alloc.construct(&*slot, std::move(tmp));
+            return slot;
+        }
+#endif
+
+        void insert (iterator position, size_type n, const value_type& val)
+        {
+            value_type copy (val);
+            for (size_type i = 0; i < n; ++i)
+                position = ++insert(position, copy);
+        }
+
+        template <class InputIterator>
+        void insert (iterator position, InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+        {
+            for (; first != last; ++first)
+                position = ++insert(position, *first);
+        }
+
+        iterator erase (iterator position)
+        {
+            iterator next = position;
+            ++next;
+            return erase(position, next);
+        }
+
+        // the nodes covered by the range are freed whole, the elements of
+        // the nodes at its ends are shifted
+        iterator erase (iterator first, iterator last)
+        {
+            if (first == last)
+                return last;
+            base_pointer node = first.get_node();
+            size_type index = first.get_index();
+            while (node != last.get_node()) {
+                erase_in_node(node, index, node->count - index);
+                if (index != 0) {
+                    node = node->next;
+                    index = 0;
+                }
+            }
+            erase_in_node(node, index, last.get_index() - index);
+            return rebalance(node, index);
+        }
+
+        // the sentinels stay in place, only the first & last nodes are
+        // relinked to their new sentinel
+        void swap (unrolled_list& x)
+        {
+            ft::swap(_alloc, x._alloc);
+            ft::swap(_node_alloc, x._node_alloc);
+            ft::swap(_size, x._size);
+            ft::swap(_sentinel.next, x._sentinel.next);
+            ft::swap(_sentinel.prev, x._sentinel.prev);
+            relink_sentinel();
+            x.relink_sentinel();
+        }
+
+        void resize (size_type n, value_type val = value_type())
+        {
+            while (n < _size)
+                pop_back();
+            while (n > _size)
+                push_back(val);
+        }
+
+        void clear (void)
+        {
+            base_pointer node = _sentinel.next;
+            while (node != &_sentinel) {
+                base_pointer next = node->next;
+                destroy_range(values_of(node), values_of(node) + node->count);
+                delete_node(node);
+                node = next;
+            }
+            initialize_sentinel();
+            _size = 0;
+        }
+
+        /* OPERATIONS */
+        // the nodes of x are relinked, the node at position is split if
+        // position is not its first element
+        void splice (iterator position, unrolled_list& x)
+        {
+            if (&x == this || x._size == 0)
+                return ;
+            base_pointer before = split(position.get_node(), position.get_index());
+            transfer(before, x._sentinel.next, &x._sentinel);
+            _size += x._size;
+            x._size = 0;
+        }
+
+        // a single element moves to another list by value, within the same
+        // list its node is split around it
+        void splice (iterator position, unrolled_list& x, iterator i)
+        {
+            iterator next = i;
+            ++next;
+            if (position == i || position == next)
+                return ;
+            if (&x == this)
+                return splice(position, x, i, next);
+#ifdef FT_HAS_CXX11
+            insert(position, std::move(*i));
+#else
+            insert(position, *i);
+#endif
+            x.erase(i);
+        }
+
+        // the nodes at first, last & position are split so that the range
+        // is made of whole nodes, which are relinked before position. the
+        // count of the range is only walked node by node between lists
+        void splice (iterator position, unrolled_list& x, iterator first, iterator last)
+        {
+            if (first == last)
+                return ;
+            base_pointer node = position.get_node();
+            size_type index = position.get_index();
+            base_pointer to = split(last.get_node(), last.get_index());
+            // position may follow last in the node which was split
+            if (node == last.get_node() && to != node && index >= last.get_index()) {
+                node = to;
+                index -= last.get_index();
+            }
+            base_pointer from = split(first.get_node(), first.get_index());
+            base_pointer before = split(node, index);
+            if (&x != this) {
+                size_type n = 0;
+                for (base_pointer p = from; p != to; p = p->next)
+                    n += p->count;
+                x._size -= n;
+                _size += n;
+            }
+            transfer(before, from, to);
+        }
+
+        void remove (const value_type& val)
+        {
+            // val may refer to an element which is about to be removed
+            value_type copy (val);
+            compact(drop_equal(copy));
+        }
+
+        template <class Predicate>
+        void remove_if (Predicate pred)
+        {
+            compact(drop_if<Predicate>(pred));
+        }
+
+        void unique (void)
+        {
+            unique(std::equal_to<value_type>());
+        }
+
+        template <class BinaryPredicate>
+        void unique (BinaryPredicate binary_pred)
+        {
+            compact(drop_duplicate<BinaryPredicate>(binary_pred));
+        }
+
+        void merge (unrolled_list& x)
+        {
+            merge(x, std::less<value_type>());
+        }
+
+        // the elements of both lists are relocated into packed nodes
+        template <class Compare>
+        void merge (unrolled_list& x, Compare comp)
+        {
+            if (&x == this || x._size == 0)
+                return ;
+            if (_size == 0)
+                return splice(end(), x);
+            run merged = merge_runs(detach(), x.detach(), comp);
+            attach(merged);
+            _size += x._size;
+            x._size = 0;
+        }
+
+        void sort (void)
+        {
+            sort(std::less<value_type>());
+        }
+
+        // each node is insertion sorted, then the nodes are merged bottom-up
+        // like the nodes of ft::list: bucket i holds a sorted run of 2^i
+        // nodes or nothing & the runs of the higher buckets hold the earlier
+        // elements, which keeps the sort stable
+        template <class Compare>
+        void sort (Compare comp)
+        {
+            if (_size < 2)
+                return ;
+
+            run buckets[sizeof(size_type) * CHAR_BIT];
+            size_type used = 0;
+            run chain = detach();
+            while (chain.first) {
+                run carry = { chain.first, chain.first };
+                chain.first = chain.first->next;
+                carry.first->next = NULL;
+                sort_node(carry.first, comp);
+                size_type i = 0;
+                for (; i < used && buckets[i].first; ++i) {
+                    carry = merge_runs(buckets[i], carry, comp);
+                    buckets[i].first = NULL;
+                }
+                buckets[i] = carry;
+                if (i == used)
+                    ++used;
+            }
+            run result = { NULL, NULL };
+            for (size_type i = 0; i < used; ++i) {
+                if (buckets[i].first)
+                    result = result.first ? merge_runs(buckets[i], result, comp) : buckets[i];
+            }
+            attach(result);
+        }
+
+        // the nodes swap their links & reverse their elements
+        void reverse (void)
+        {
+            base_pointer node = &_sentinel;
+            do {
+                ft::swap(node->next, node->prev);
+                if (node->count > 1) {
+                    value_type * values = values_of(node);
+                    for (size_type i = 0; i < node->count / 2; ++i)
+                        ft::swap(values[i], values[node->count - 1 - i]);
+                }
+                node = node->prev;
+            } while (node != &_sentinel);
+        }
+
+    private:
+        allocator_type _alloc;
+        node_allocator _node_alloc;
+        size_type _size;
+        // holds no value, it is not allocated
+        unrolled_node_base _sentinel;
+
+        static value_type * values_of (base_pointer p) { return static_cast<node_pointer>(p)->values(); }
+        static const value_type * values_of (const unrolled_node_base * p) { return static_cast<const node*>(p)->values(); }
+        static size_type last_index (const unrolled_node_base * p) { return p->count ? p->count - 1 : 0; }
+
+        /* SENTINEL */
+        void initialize_sentinel (void)
+        {
+            _sentinel.next = &_sentinel;
+            _sentinel.prev = &_sentinel;
+        }
+
+        // points the first & last nodes back to the sentinel
+        void relink_sentinel (void)
+        {
+            if (_size == 0) {
+                initialize_sentinel();
+            } else {
+                _sentinel.next->prev = &_sentinel;
+                _sentinel.prev->next = &_sentinel;
+            }
+        }
+
+        /* NODES */
+        // links node before position & returns it
+        static base_pointer link_node (base_pointer node, base_pointer position)
+        {
+            node->prev = position->prev;
+            node->next = position;
+            position->prev->next = node;
+            position->prev = node;
+            return node;
+        }
+
+        static base_pointer unlink_node (base_pointer node)
+        {
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+            return node;
+        }
+
+        // moves the nodes [first, last) before position, the range can
+        // belong to another list but may not contain position
+        static void transfer (base_pointer position, base_pointer first, base_pointer last)
+        {
+            if (position == last || position == first)
+                return ;
+            base_pointer tmp = last->prev;
+            first->prev->next = last;
+            last->prev = first->prev;
+            position->prev->next = first;
+            first->prev = position->prev;
+            tmp->next = position;
+            position->prev = tmp;
+        }
+
+        // the last node if it has room, else a new one
+        base_pointer back_node (void)
+        {
+            base_pointer last = _sentinel.prev;
+            if (last == &_sentinel || last->count == node_capacity)
+                last = link_node(new_node(), &_sentinel);
+            return last;
+        }
+
+        // moves the elements from index to the end of node into a new node
+        // linked after it & returns the node starting at index, index has
+        // to be a valid position in node
+        base_pointer split (base_pointer node, size_type index)
+        {
+            if (index == 0)
+                return node;
+            base_pointer upper = link_node(new_node(), node->next);
+            relocate(values_of(upper), values_of(node) + index, node->count - index);
+            upper->count = node->count - index;
+            node->count = index;
+            return upper;
+        }
+
+        // opens an unconstructed slot before position & returns it. the slot
+        // is appended to the previous node when position starts a node & the
+        // previous one has room, a full node is split in halves
+        iterator make_slot (iterator position)
+        {
+            base_pointer node = position.get_node();
+            size_type index = position.get_index();
+            if (index == 0 && node->prev != &_sentinel && node->prev->count < node_capacity) {
+                node = node->prev;
+                index = node->count;
+            } else if (node == &_sentinel) {
+                node = link_node(new_node(), &_sentinel);
+            } else if (node->count == node_capacity) {
+                base_pointer upper = split(node, node_capacity / 2);
+                if (index > node->count) {
+                    index -= node->count;
+                    node = upper;
+                }
+            }
+            relocate(values_of(node) + index + 1, values_of(node) + index, node->count - index);
+            ++node->count;
+            ++_size;
+            return iterator(node, index);
+        }
+
+        // erases n elements from index, a node left empty is freed & the
+        // position moves to the start of the next one
+        void erase_in_node (base_pointer& node, size_type& index, size_type n)
+        {
+            if (n == 0)
+                return ;
+            value_type * values = values_of(node);
+            destroy_range(values + index, values + index + n);
+            relocate(values + index, values + index + n, node->count - index - n);
+            node->count -= n;
+            _size -= n;
+            if (node->count == 0) {
+                base_pointer next = node->next;
+                delete_node(unlink_node(node));
+                node = next;
+                index = 0;
+            }
+        }
+
+        // merges the node before position with its successor when one of
+        // them is less than half full & both fit in a single node, index
+        // may be the count of node to stand for the start of the next one
+        iterator rebalance (base_pointer node, size_type index)
+        {
+            base_pointer lower = index == 0 ? node->prev : node;
+            base_pointer upper = lower->next;
+            if (lower != &_sentinel && upper != &_sentinel
+                && lower->count + upper->count <= node_capacity
+                && (lower->count < node_capacity / 2 || upper->count < node_capacity / 2)) {
+                relocate(values_of(lower) + lower->count, values_of(upper), upper->count);
+                if (node == upper) {
+                    node = lower;
+                    index = lower->count;
+                }
+                lower->count += upper->count;
+                delete_node(unlink_node(upper));
+            }
+            if (node != &_sentinel && index == node->count) {
+                node = node->next;
+                index = 0;
+            }
+            return iterator(node, index);
+        }
+
+        /* COMPACTION */
+        // the kept elements are relocated to the front of the list through a
+        // write cursor which packs the nodes it walks, the nodes left behind
+        // it are freed. drop sees a whole node before any of its elements is
+        // moved & the list is relinked after each node, so it stays valid if
+        // drop throws, with only the nodes before compacted
+        template <class Drop>
+        void compact (Drop drop)
+        {
+            base_pointer write = &_sentinel;
+            size_type index = node_capacity;
+            value_type * kept = NULL;
+            bool dropped[node_capacity];
+            base_pointer read = _sentinel.next;
+            while (read != &_sentinel) {
+                value_type * values = values_of(read);
+                size_type count = read->count;
+                for (size_type i = 0; i < count; ++i) {
+                    dropped[i] = drop(kept, values[i]);
+                    if (!dropped[i])
+                        kept = values + i;
+                }
+                for (size_type i = 0; i < count; ++i) {
+                    if (dropped[i]) {
+                        _alloc.destroy(values + i);
+                        --_size;
+                        continue ;
+                    }
+                    if (index == node_capacity) {
+                        if (write != &_sentinel)
+                            write->count = node_capacity;
+                        write = write->next;
+                        index = 0;
+                    }
+                    if (values_of(write) + index != values + i)
+                        relocate_one(values_of(write) + index, values + i);
+                    ++index;
+                }
+                base_pointer next = read->next;
+                if (write != &_sentinel) {
+                    write->count = index;
+                    kept = values_of(write) + index - 1;
+                }
+                // the nodes after write up to read are left empty
+                delete_nodes(write->next, next);
+                write->next = next;
+                next->prev = write;
+                read = next;
+            }
+        }
+
+        struct drop_equal
+        {
+            const value_type& val;
+
+            drop_equal (const value_type& v) : val(v) {}
+
+            bool operator() (const value_type*, const value_type& x) const { return x == val; }
+        };
+
+        template <class Predicate>
+        struct drop_if
+        {
+            Predicate pred;
+
+            drop_if (Predicate p) : pred(p) {}
+
+            bool operator() (const value_type*, value_type& x) { return pred(x); }
+        };
+
+        // x is compared to the last element kept
+        template <class BinaryPredicate>
+        struct drop_duplicate
+        {
+            BinaryPredicate pred;
+
+            drop_duplicate (BinaryPredicate p) : pred(p) {}
+
+            bool operator() (value_type* kept, value_type& x) { return kept && pred(*kept, x); }
+        };
+
+        /* RUNS */
+        // cuts the ring into a run & leaves the list empty, its size is
+        // left to the caller
+        run detach (void)
+        {
+            run chain = { _sentinel.next, _sentinel.prev };
+            chain.last->next = NULL;
+            initialize_sentinel();
+            return chain;
+        }
+
+        // links the nodes of chain between the sentinels & restores their
+        // prev links
+        void attach (run chain)
+        {
+            base_pointer prev = &_sentinel;
+            for (base_pointer node = chain.first; node; prev = node, node = node->next) {
+                prev->next = node;
+                node->prev = prev;
+            }
+            prev->next = &_sentinel;
+            _sentinel.prev = prev;
+        }
+
+        // merges two sorted runs, the elements are relocated into new packed
+        // nodes & the emptied nodes are freed. the elements of later only go
+        // first when they compare less, so equal elements of earlier stay
+        // ahead. runs already in order are only chained
+        template <class Compare>
+        run merge_runs (run earlier, run later, Compare& comp)
+        {
+            if (!comp(values_of(later.first)[0], values_of(earlier.last)[earlier.last->count - 1])) {
+                earlier.last->next = later.first;
+                earlier.last = later.last;
+                return earlier;
+            }
+            run out = { NULL, NULL };
+            size_type i = 0;
+            size_type j = 0;
+            while (earlier.first && later.first) {
+                if (comp(values_of(later.first)[j], values_of(earlier.first)[i]))
+                    take(out, later.first, j);
+                else
+                    take(out, earlier.first, i);
+            }
+            run& rest = earlier.first ? earlier : later;
+            size_type& index = earlier.first ? i : j;
+            // the rest of a node partially taken is relocated, the nodes
+            // which follow are chained as they are
+            while (index != 0)
+                take(out, rest.first, index);
+            if (rest.first) {
+                out.last->next = rest.first;
+                out.last = rest.last;
+            }
+            return out;
+        }
+
+        // relocates the element at index in node to the end of out, node is
+        // freed & replaced by its successor once it has been taken whole
+        void take (run& out, base_pointer& node, size_type& index)
+        {
+            if (out.last == NULL || out.last->count == node_capacity) {
+                base_pointer next = new_node();
+                if (out.last)
+                    out.last->next = next;
+                else
+                    out.first = next;
+                out.last = next;
+            }
+            relocate_one(values_of(out.last) + out.last->count++, values_of(node) + index);
+            if (++index == node->count) {
+                base_pointer next = node->next;
+                delete_node(node);
+                node = next;
+                index = 0;
+            }
+        }
+
+        template <class Compare>
+        static void sort_node (base_pointer node, Compare& comp)
+        {
+            value_type * values = values_of(node);
+            for (size_type i = 1; i < node->count; ++i) {
+                for (size_type j = i; j > 0 && comp(values[j], values[j - 1]); --j)
+                    ft::swap(values[j], values[j - 1]);
+            }
+        }
+
+        /* MEMORY MANAGEMENT */
+        // the elements are constructed in the node later on
+        base_pointer new_node (void)
+        {
+            node_pointer p = _node_alloc.allocate(1);
+            ::new (static_cast<void*>(p)) node;
+            return p;
+        }
+
+        // the elements have to be destroyed already
+        void delete_node (base_pointer p)
+        {
+            _node_alloc.deallocate(static_cast<node_pointer>(p), 1);
+        }
+
+        void delete_nodes (base_pointer first, base_pointer last)
+        {
+            while (first != last) {
+                base_pointer next = first->next;
+                delete_node(first);
+                first = next;
+            }
+        }
+
+        // moves n elements from src to the unconstructed slots at dst,
+        // the ranges may overlap
+        void relocate (value_type * dst, value_type * src, size_type n)
+        {
+            if (n == 0 || dst == src)
+                return ;
+            if (ft::is_trivially_relocatable<value_type>::value) {
+                std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            } else if (dst < src) {
+                for (size_type i = 0; i < n; ++i)
+                    relocate_one(dst + i, src + i);
+            } else {
+                for (size_type i = n; i > 0; --i)
+                    relocate_one(dst + i - 1, src + i - 1);
+            }
+        }
+
+        void relocate_one (value_type * dst, value_type * src)
+        {
+#ifdef FT_HAS_CXX11
+            _alloc.construct(dst, std::move_if_noexcept(*src));
+#else
+            _alloc.construct(dst, *src);
+#endif
+            _alloc.destroy(src);
+        }
+
+        // trivially copyable types have nothing to destroy
+        void destroy_range (value_type * first, value_type * last)
+        {
+            if (ft::is_trivially_copyable<value_type>::value)
+                return ;
+            for (; first != last; ++first)
+                _alloc.destroy(first);
+        }
+
+}; // CLASS UNROLLED_LIST
+
+template <class T, size_t N, class Alloc>
+void swap (unrolled_list<T, N, Alloc>& x, unrolled_list<T, N, Alloc>& y)
+{
+    x.swap(y);
+}
+
+} // NAMESPACE FT
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "unrolled_list_node.hpp"
+#include "../utils/utils.hpp"
+
+#include <cstddef> // NULL, std::ptrdiff_t, size_t
+
+#include <iterator> // std::bidirectional_iterator_tag
+
+namespace ft {
+
+// an element is found by its node & its index in the node, end() is the
+// sentinel with the index 0
+template <class T, size_t N, bool is_const>
+class unrolled_list_iterator
+{
+    public:
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename choose<is_const, const T*, T*>::type pointer;
+        typedef typename choose<is_const, const T&, T&>::type reference;
+        typedef std::bidirectional_iterator_tag iterator_category;
+
+    private:
+        typedef unrolled_list_iterator<value_type, N, is_const> self_type;
+        typedef typename choose<is_const, const unrolled_node_base*, unrolled_node_base*>::type node_pointer;
+        typedef typename choose<is_const, const unrolled_node<value_type, N>*, unrolled_node<value_type, N>*>::type value_node_pointer;
+
+    public:
+        /* CONSTRUCTORS */
+        unrolled_list_iterator (node_pointer node = NULL, size_t index = 0)
+            : _node(node), _index(index)
+        {
+        }
+
+        unrolled_list_iterator (const unrolled_list_iterator<value_type, N, false>& other)
+            : _node(other.get_node()), _index(other.get_index())
+        {
+        }
+
+        /* OPERATORS */
+        unrolled_list_iterator& operator= (const self_type& other)
+        {
+            if (this != &other) {
+                _node = other._node;
+                _index = other._index;
+            }
+            return *this;
+        }
+
+        friend bool operator== (const self_type& rhs, const self_type& lhs) { return rhs._node == lhs._node && rhs._index == lhs._index; }
+        friend bool operator!= (const self_type& rhs, const self_type& lhs) { return !(rhs == lhs); }
+
+        reference operator* (void) { return static_cast<value_node_pointer>(_node)->values()[_index]; }
+        pointer operator-> (void) { return &static_cast<value_node_pointer>(_node)->values()[_index]; }
+
+        self_type& operator++ (void)
+        {
+            if (++_index == _node->count) {
+                _node = _node->next;
+                _index = 0;
+            }
+            return *this;
+        }
+
+        self_type operator++ (int)
+        {
+            self_type tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        // the sentinel counts no element, stepping back onto it from the
+        // first element gives the index 0
+        self_type& operator-- (void)
+        {
+            if (_index == 0) {
+                _node = _node->prev;
+                _index = _node->count ? _node->count - 1 : 0;
+            } else {
+                --_index;
+            }
+            return *this;
+        }
+
+        self_type operator-- (int)
+        {
+            self_type tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        /* GETTERS */
+        node_pointer get_node (void) const { return _node; }
+        size_t get_index (void) const { return _index; }
+
+    private:
+        node_pointer _node;
+        size_t _index;
+
+}; // CLASS UNROLLED_LIST_ITERATOR
+
+template <class T, size_t N, bool is_const>
+class reverse_unrolled_list_iterator
+{
+    public:
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename choose<is_const, const T*, T*>::type pointer;
+        typedef typename choose<is_const, const T&, T&>::type reference;
+        typedef std::bidirectional_iterator_tag iterator_category;
+
+    private:
+        typedef reverse_unrolled_list_iterator<value_type, N, is_const> self_type;
+        typedef typename choose<is_const, const unrolled_node_base*, unrolled_node_base*>::type node_pointer;
+        typedef typename choose<is_const, const unrolled_node<value_type, N>*, unrolled_node<value_type, N>*>::type value_node_pointer;
+
+    public:
+        /* CONSTRUCTORS */
+        reverse_unrolled_list_iterator (node_pointer node = NULL, size_t index = 0)
+            : _node(node), _index(index)
+        {
+        }
+
+        reverse_unrolled_list_iterator (const reverse_unrolled_list_iterator<value_type, N, false>& other)
+            : _node(other.get_node()), _index(other.get_index())
+        {
+        }
+
+        /* OPERATORS */
+        reverse_unrolled_list_iterator& operator= (const self_type& other)
+        {
+            if (this != &other) {
+                _node = other._node;
+                _index = other._index;
+            }
+            return *this;
+        }
+
+        friend bool operator== (const self_type& rhs, const self_type& lhs) { return rhs._node == lhs._node && rhs._index == lhs._index; }
+        friend bool operator!= (const self_type& rhs, const self_type& lhs) { return !(rhs == lhs); }
+
+        reference operator* (void) { return static_cast<value_node_pointer>(_node)->values()[_index]; }
+        pointer operator-> (void) { return &static_cast<value_node_pointer>(_node)->values()[_index]; }
+
+        self_type& operator++ (void)
+        {
+            if (_index == 0) {
+                _node = _node->prev;
+                _index = _node->count ? _node->count - 1 : 0;
+            } else {
+                --_index;
+            }
+            return *this;
+        }
+
+        self_type operator++ (int)
+        {
+            self_type tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        self_type& operator-- (void)
+        {
+            if (++_index == _node->count) {
+                _node = _node->next;
+                _index = 0;
+            }
+            return *this;
+        }
+
+        self_type operator-- (int)
+        {
+            self_type tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        /* GETTERS */
+        node_pointer get_node (void) const { return _node; }
+        size_t get_index (void) const { return _index; }
+
+    private:
+        node_pointer _node;
+        size_t _index;
+
+}; // CLASS REVERSE_UNROLLED_LIST_ITERATOR
+
+} // NAMESPACE FT
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "../utils/utils.hpp" // ft::aligned_buffer
+
+#include <cstddef> // NULL, size_t
+
+namespace ft {
+
+/* DEFAULT CAPACITY */
+// the nodes of an unrolled_list hold about 256 bytes of elements by
+// default, 4 elements at least
+template <class T>
+struct unrolled_default_capacity
+{
+    static const size_t value = 256 / sizeof(T) > 4 ? 256 / sizeof(T) : 4;
+};
+
+// the links & element count of a node without its elements, the list
+// embeds one as its sentinel which always counts 0 elements
+struct unrolled_node_base
+{
+    unrolled_node_base * prev;
+    unrolled_node_base * next;
+    size_t count;
+
+    unrolled_node_base (void)
+        : prev(NULL), next(NULL), count(0)
+    {
+    }
+
+}; // STRUCT UNROLLED_NODE_BASE
+
+// the first count slots of the buffer hold constructed elements, the
+// others are raw storage
+template <class T, size_t N>
+struct unrolled_node : unrolled_node_base
+{
+    aligned_buffer<T, N> storage;
+
+    T * values (void) { return storage.data(); }
+    const T * values (void) const { return storage.data(); }
+
+}; // STRUCT UNROLLED_NODE
+
+} // NAMESPACE FT
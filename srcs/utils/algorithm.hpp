@@ -0,0 +1,288 @@
+#pragma once
+
+#include "utils.hpp" // enable_if, min
+
+#include <cstddef> // std::ptrdiff_t
+
+namespace ft {
+
+/* SEGMENTED ITERATOR TRAITS */
+// a segmented iterator walks a sequence made of contiguous segments, like
+// the chunks of a deque. the algorithms below split such ranges into their
+// segments & run plain pointer loops over each of them, instead of paying
+// for the segment checks of the iterator at every step
+//
+// a specialization defines is_segmented as true, the segment_iterator &
+// local_iterator types, segment(it) & local(it) to split an iterator, the
+// [begin(s), end(s)) bounds of a segment & compose(s, local) to rebuild an
+// iterator. segmented iterators must be random access iterators
+template <class Iterator>
+struct segmented_iterator_traits
+{
+    static const bool is_segmented = false;
+};
+
+/* CONTIGUOUS ITERATOR TRAITS */
+// a contiguous iterator walks elements laid out in a single array, a range
+// of them can be copied at once. a specialization defines is_contiguous as
+// true, the value_type without its const & address(it) to get a pointer
+template <class Iterator>
+struct contiguous_iterator_traits
+{
+    static const bool is_contiguous = false;
+};
+
+template <class T>
+struct contiguous_iterator_traits<T*>
+{
+    static const bool is_contiguous = true;
+
+    typedef T value_type;
+
+    static const T* address (T* it) { return it; }
+};
+
+template <class T>
+struct contiguous_iterator_traits<const T*>
+{
+    static const bool is_contiguous = true;
+
+    typedef T value_type;
+
+    static const T* address (const T* it) { return it; }
+};
+
+/* FOR EACH */
+template <class InputIterator, class Function>
+typename ft::enable_if< !segmented_iterator_traits<InputIterator>::is_segmented, Function >::type
+for_each (InputIterator first, InputIterator last, Function f)
+{
+    for (; first != last; ++first)
+        f(*first);
+    return f;
+}
+
+template <class SegmentedIterator, class Function>
+typename ft::enable_if< segmented_iterator_traits<SegmentedIterator>::is_segmented, Function >::type
+for_each (SegmentedIterator first, SegmentedIterator last, Function f)
+{
+    typedef segmented_iterator_traits<SegmentedIterator> traits;
+    typename traits::segment_iterator seg = traits::segment(first);
+    typename traits::segment_iterator seg_last = traits::segment(last);
+
+    if (seg == seg_last)
+        return ft::for_each(traits::local(first), traits::local(last), f);
+    f = ft::for_each(traits::local(first), traits::end(seg), f);
+    for (++seg; seg != seg_last; ++seg)
+        f = ft::for_each(traits::begin(seg), traits::end(seg), f);
+    return ft::for_each(traits::begin(seg), traits::local(last), f);
+}
+
+/* FILL */
+template <class ForwardIterator, class T>
+typename ft::enable_if< !segmented_iterator_traits<ForwardIterator>::is_segmented, void >::type
+fill (ForwardIterator first, ForwardIterator last, const T& val)
+{
+    for (; first != last; ++first)
+        *first = val;
+}
+
+template <class SegmentedIterator, class T>
+typename ft::enable_if< segmented_iterator_traits<SegmentedIterator>::is_segmented, void >::type
+fill (SegmentedIterator first, SegmentedIterator last, const T& val)
+{
+    typedef segmented_iterator_traits<SegmentedIterator> traits;
+    typename traits::segment_iterator seg = traits::segment(first);
+    typename traits::segment_iterator seg_last = traits::segment(last);
+
+    if (seg == seg_last)
+        return ft::fill(traits::local(first), traits::local(last), val);
+    ft::fill(traits::local(first), traits::end(seg), val);
+    for (++seg; seg != seg_last; ++seg)
+        ft::fill(traits::begin(seg), traits::end(seg), val);
+    ft::fill(traits::begin(seg), traits::local(last), val);
+}
+
+/* FIND */
+template <class InputIterator, class T>
+typename ft::enable_if< !segmented_iterator_traits<InputIterator>::is_segmented, InputIterator >::type
+find (InputIterator first, InputIterator last, const T& val)
+{
+    for (; first != last; ++first) {
+        if (*first == val)
+            break ;
+    }
+    return first;
+}
+
+template <class SegmentedIterator, class T>
+typename ft::enable_if< segmented_iterator_traits<SegmentedIterator>::is_segmented, SegmentedIterator >::type
+find (SegmentedIterator first, SegmentedIterator last, const T& val)
+{
+    typedef segmented_iterator_traits<SegmentedIterator> traits;
+    typedef typename traits::local_iterator local_iterator;
+    typename traits::segment_iterator seg = traits::segment(first);
+    typename traits::segment_iterator seg_last = traits::segment(last);
+
+    if (seg == seg_last)
+        return traits::compose(seg, ft::find(traits::local(first), traits::local(last), val));
+    local_iterator it = ft::find(traits::local(first), traits::end(seg), val);
+    if (it != traits::end(seg))
+        return traits::compose(seg, it);
+    for (++seg; seg != seg_last; ++seg) {
+        it = ft::find(traits::begin(seg), traits::end(seg), val);
+        if (it != traits::end(seg))
+            return traits::compose(seg, it);
+    }
+    return traits::compose(seg, ft::find(traits::begin(seg), traits::local(last), val));
+}
+
+/* COPY */
+// a segmented source is copied segment by segment, a contiguous source into
+// a segmented destination is copied by runs fitting a destination segment
+template <class InputIterator, class OutputIterator>
+typename ft::enable_if< !segmented_iterator_traits<InputIterator>::is_segmented, OutputIterator >::type
+copy (InputIterator first, InputIterator last, OutputIterator result)
+{
+    for (; first != last; ++first, ++result)
+        *result = *first;
+    return result;
+}
+
+template <class T, class OutputIterator>
+typename ft::enable_if< segmented_iterator_traits<OutputIterator>::is_segmented, OutputIterator >::type
+copy_to_segments (const T* first, const T* last, OutputIterator result)
+{
+    typedef segmented_iterator_traits<OutputIterator> traits;
+
+    while (first != last) {
+        typename traits::local_iterator out = traits::local(result);
+        std::ptrdiff_t run = ft::min(last - first, traits::end(traits::segment(result)) - out);
+        for (std::ptrdiff_t i = 0; i < run; ++i)
+            out[i] = first[i];
+        first += run;
+        result += run;
+    }
+    return result;
+}
+
+template <class T, class OutputIterator>
+typename ft::enable_if< !segmented_iterator_traits<OutputIterator>::is_segmented, OutputIterator >::type
+copy_to_segments (const T* first, const T* last, OutputIterator result)
+{
+    for (; first != last; ++first, ++result)
+        *result = *first;
+    return result;
+}
+
+template <class T, class OutputIterator>
+OutputIterator copy (T* first, T* last, OutputIterator result)
+{
+    return ft::copy_to_segments(static_cast<const T*>(first), static_cast<const T*>(last), result);
+}
+
+template <class T, class OutputIterator>
+OutputIterator copy (const T* first, const T* last, OutputIterator result)
+{
+    return ft::copy_to_segments(first, last, result);
+}
+
+template <class SegmentedIterator, class OutputIterator>
+typename ft::enable_if< segmented_iterator_traits<SegmentedIterator>::is_segmented, OutputIterator >::type
+copy (SegmentedIterator first, SegmentedIterator last, OutputIterator result)
+{
+    typedef segmented_iterator_traits<SegmentedIterator> traits;
+    typename traits::segment_iterator seg = traits::segment(first);
+    typename traits::segment_iterator seg_last = traits::segment(last);
+
+    if (seg == seg_last)
+        return ft::copy(traits::local(first), traits::local(last), result);
+    result = ft::copy(traits::local(first), traits::end(seg), result);
+    for (++seg; seg != seg_last; ++seg)
+        result = ft::copy(traits::begin(seg), traits::end(seg), result);
+    return ft::copy(traits::begin(seg), traits::local(last), result);
+}
+
+/* COMPARISONS */
+// two segmented ranges are walked by runs which are contiguous in both
+template <class InputIterator1, class InputIterator2>
+typename ft::enable_if< !segmented_iterator_traits<InputIterator1>::is_segmented
+                        || !segmented_iterator_traits<InputIterator2>::is_segmented, bool >::type
+equal (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+{
+    for (; first1 != last1; ++first1, ++first2) {
+        if (!(*first1 == *first2))
+            return false;
+    }
+    return true;
+}
+
+template <class SegmentedIterator1, class SegmentedIterator2>
+typename ft::enable_if< segmented_iterator_traits<SegmentedIterator1>::is_segmented
+                        && segmented_iterator_traits<SegmentedIterator2>::is_segmented, bool >::type
+equal (SegmentedIterator1 first1, SegmentedIterator1 last1, SegmentedIterator2 first2)
+{
+    typedef segmented_iterator_traits<SegmentedIterator1> traits1;
+    typedef segmented_iterator_traits<SegmentedIterator2> traits2;
+
+    while (first1 != last1) {
+        typename traits1::local_iterator p1 = traits1::local(first1);
+        typename traits2::local_iterator p2 = traits2::local(first2);
+        std::ptrdiff_t run = ft::min(traits1::end(traits1::segment(first1)) - p1,
+                                     traits2::end(traits2::segment(first2)) - p2);
+        if (traits1::segment(first1) == traits1::segment(last1))
+            run = ft::min(run, traits1::local(last1) - p1);
+        for (std::ptrdiff_t i = 0; i < run; ++i) {
+            if (!(p1[i] == p2[i]))
+                return false;
+        }
+        first1 += run;
+        first2 += run;
+    }
+    return true;
+}
+
+template <class InputIterator1, class InputIterator2>
+typename ft::enable_if< !segmented_iterator_traits<InputIterator1>::is_segmented
+                        || !segmented_iterator_traits<InputIterator2>::is_segmented, bool >::type
+lexicographical_compare (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+{
+    for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+        if (*first1 < *first2)
+            return true;
+        if (*first2 < *first1)
+            return false;
+    }
+    return first1 == last1 && first2 != last2;
+}
+
+template <class SegmentedIterator1, class SegmentedIterator2>
+typename ft::enable_if< segmented_iterator_traits<SegmentedIterator1>::is_segmented
+                        && segmented_iterator_traits<SegmentedIterator2>::is_segmented, bool >::type
+lexicographical_compare (SegmentedIterator1 first1, SegmentedIterator1 last1, SegmentedIterator2 first2, SegmentedIterator2 last2)
+{
+    typedef segmented_iterator_traits<SegmentedIterator1> traits1;
+    typedef segmented_iterator_traits<SegmentedIterator2> traits2;
+
+    while (first1 != last1 && first2 != last2) {
+        typename traits1::local_iterator p1 = traits1::local(first1);
+        typename traits2::local_iterator p2 = traits2::local(first2);
+        std::ptrdiff_t run = ft::min(traits1::end(traits1::segment(first1)) - p1,
+                                     traits2::end(traits2::segment(first2)) - p2);
+        if (traits1::segment(first1) == traits1::segment(last1))
+            run = ft::min(run, traits1::local(last1) - p1);
+        if (traits2::segment(first2) == traits2::segment(last2))
+            run = ft::min(run, traits2::local(last2) - p2);
+        for (std::ptrdiff_t i = 0; i < run; ++i) {
+            if (p1[i] < p2[i])
+                return true;
+            if (p2[i] < p1[i])
+                return false;
+        }
+        first1 += run;
+        first2 += run;
+    }
+    return first1 == last1 && first2 != last2;
+}
+
+} // NAMESPACE FT
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <cstddef> // size_t, std::ptrdiff_t, NULL
+#include <new> // placement new, ::operator new
+
+#include "utils.hpp" // FT_HAS_CXX11
+
+namespace ft {
+
+/* POOL STATE */
+// slabs & free list shared by the copies of a node_pool, every pool knows the
+// size of its slots and belongs to a ring of the pools rebound from one another
+struct pool_state
+{
+    // a free slot stores the address of the next free slot, each slab
+    // starts with the address of the previous slab
+    struct free_slot
+    {
+        free_slot * next;
+    };
+
+    free_slot * free_list;
+    free_slot * slabs;
+    char * cursor;
+    char * slab_end;
+    size_t slot;
+    size_t slab_nodes;
+    size_t refs;
+    pool_state * prev;
+    pool_state * next;
+};
+
+/* NODE POOL */
+// allocator handing out single objects carved from large slabs, freed objects
+// are kept in an intrusive free list and reused by the next allocation
+//
+// copies of a node_pool share their slabs and compare equal, the slabs are
+// released once the last copy is destroyed. the pools rebound from a same
+// node_pool are shared by slot size, so containers built from one node_pool
+// allocate their nodes from the same slabs and can splice nodes between each
+// other. requests for more than one object are forwarded to ::operator new.
+// a pool must not be used by several threads at once
+template <class T>
+class node_pool
+{
+    public:
+        typedef T value_type;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <class U>
+        struct rebind
+        {
+            typedef node_pool<U> other;
+        };
+
+    private:
+        typedef pool_state::free_slot free_slot;
+
+        static const size_type first_slab_nodes = 32;
+        static const size_type max_slab_nodes = 8192;
+
+        // slots are large enough to hold a pointer once freed & are rounded
+        // up to the alignment of both T & the pointer
+        static size_type slot_size (void)
+        {
+            size_type align = alignment_of<T>::value > alignment_of<free_slot>::value ? alignment_of<T>::value : alignment_of<free_slot>::value;
+            size_type size = ft::max(sizeof(T), sizeof(free_slot));
+            return (size + align - 1) / align * align;
+        }
+
+    public:
+        /* CONSTRUCTORS */
+        node_pool (void)
+            : _pool(new_pool(NULL))
+        {
+        }
+
+        node_pool (const node_pool& other)
+            : _pool(other._pool)
+        {
+            ++_pool->refs;
+        }
+
+        template <class U>
+        node_pool (const node_pool<U>& other)
+            : _pool(rebind_pool(other.get_pool()))
+        {
+        }
+
+        /* DESTRUCTOR */
+        ~node_pool()
+        {
+            release();
+        }
+
+        /* OPERATORS */
+        node_pool& operator= (const node_pool& other)
+        {
+            if (_pool != other._pool) {
+                release();
+                _pool = other._pool;
+                ++_pool->refs;
+            }
+            return *this;
+        }
+
+        friend bool operator== (const node_pool& lhs, const node_pool& rhs) { return lhs._pool == rhs._pool; }
+        friend bool operator!= (const node_pool& lhs, const node_pool& rhs) { return lhs._pool != rhs._pool; }
+
+        /* ALLOCATION */
+        pointer allocate (size_type n, const void* = 0)
+        {
+            if (n != 1)
+                return static_cast<pointer>(::operator new(n * sizeof(T)));
+            if (_pool->free_list) {
+                free_slot * slot = _pool->free_list;
+                _pool->free_list = slot->next;
+                return reinterpret_cast<pointer>(slot);
+            }
+            if (_pool->cursor == _pool->slab_end)
+                add_slab();
+            pointer p = reinterpret_cast<pointer>(_pool->cursor);
+            _pool->cursor += _pool->slot;
+            return p;
+        }
+
+        void deallocate (pointer p, size_type n)
+        {
+            if (!p)
+                return ;
+            if (n != 1) {
+                ::operator delete(p);
+                return ;
+            }
+            free_slot * slot = reinterpret_cast<free_slot*>(p);
+            slot->next = _pool->free_list;
+            _pool->free_list = slot;
+        }
+
+#ifdef FT_HAS_CXX11
+        template <class U, class... Args>
+        void construct (U* p, Args&&... args) { new (static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+#else
+        void construct (pointer p, const_reference val) { new (static_cast<void*>(p)) T(val); }
+#endif
+        void destroy (pointer p) { p->~T(); }
+
+        /* OBSERVERS */
+        pointer address (reference x) const { return &x; }
+        const_pointer address (const_reference x) const { return &x; }
+        size_type max_size (void) const { return size_type(-1) / slot_size(); }
+
+        /* GETTER */
+        pool_state * get_pool (void) const { return _pool; }
+
+    private:
+        pool_state * _pool;
+
+        // creates a pool linked into the ring of sibling or into a ring of its own
+        static pool_state * new_pool (pool_state * sibling)
+        {
+            pool_state * p = new pool_state();
+            p->free_list = NULL;
+            p->slabs = NULL;
+            p->cursor = NULL;
+            p->slab_end = NULL;
+            p->slot = slot_size();
+            p->slab_nodes = first_slab_nodes;
+            p->refs = 1;
+            if (sibling) {
+                p->prev = sibling;
+                p->next = sibling->next;
+                sibling->next->prev = p;
+                sibling->next = p;
+            } else {
+                p->prev = p;
+                p->next = p;
+            }
+            return p;
+        }
+
+        static pool_state * rebind_pool (pool_state * origin)
+        {
+            pool_state * p = origin;
+            do {
+                if (p->slot == slot_size()) {
+                    ++p->refs;
+                    return p;
+                }
+                p = p->next;
+            } while (p != origin);
+            return new_pool(origin);
+        }
+
+        // slabs double in size up to max_slab_nodes nodes, they start with
+        // the link to the previous slab. the slots are aligned on the largest
+        // power of two dividing the slot size: every type sharing the pool
+        // has a slot size multiple of its alignment, so none needs more even
+        // beyond the alignment ::operator new guarantees
+        void add_slab (void)
+        {
+            size_type align = _pool->slot & (~_pool->slot + 1);
+            char * slab = static_cast<char*>(::operator new(sizeof(free_slot) + align - 1 + _pool->slab_nodes * _pool->slot));
+            reinterpret_cast<free_slot*>(slab)->next = _pool->slabs;
+            _pool->slabs = reinterpret_cast<free_slot*>(slab);
+            size_type misalignment = reinterpret_cast<size_t>(slab + sizeof(free_slot)) % align;
+            _pool->cursor = slab + sizeof(free_slot) + (misalignment ? align - misalignment : 0);
+            _pool->slab_end = _pool->cursor + _pool->slab_nodes * _pool->slot;
+            if (_pool->slab_nodes < max_slab_nodes)
+                _pool->slab_nodes *= 2;
+        }
+
+        void release (void)
+        {
+            if (--_pool->refs != 0)
+                return ;
+            while (_pool->slabs) {
+                free_slot * next = _pool->slabs->next;
+                ::operator delete(_pool->slabs);
+                _pool->slabs = next;
+            }
+            _pool->prev->next = _pool->next;
+            _pool->next->prev = _pool->prev;
+            delete _pool;
+        }
+
+}; // CLASS NODE_POOL
+
+} // NAMESPACE FT
@@ -1,5 +1,20 @@
 #pragma once
 
+// the containers are C++98 compliant, move semantics & emplacement
+// are only compiled when the compiler supports them
+#if __cplusplus >= 201103L
+# define FT_HAS_CXX11 1
+#endif
+
+#include <cstddef> // std::ptrdiff_t, size_t
+#include <cstring> // std::memcpy
+#include <limits> // std::numeric_limits
+
+#ifdef FT_HAS_CXX11
+# include <utility> // std::move
+# include <type_traits> // std::is_trivially_copyable
+#endif
+
 namespace ft {
 
 /* CHOOSE */
@@ -30,13 +45,167 @@ struct enable_if<true, T>
     typedef T type;
 };
 
+/* IS SAME */
+template <class T, class U>
+struct is_same
+{
+    static const bool value = false;
+};
+
+template <class T>
+struct is_same<T, T>
+{
+    static const bool value = true;
+};
+
+/* TRIVIALLY COPYABLE */
+// elements of trivially copyable types can be shifted with memmove instead
+// of being constructed & destroyed one by one. without C++11 only the
+// arithmetic & pointer types are known to be trivially copyable
+template <class T>
+struct is_trivially_copyable
+{
+#ifdef FT_HAS_CXX11
+    static const bool value = std::is_trivially_copyable<T>::value;
+#else
+    static const bool value = std::numeric_limits<T>::is_specialized;
+#endif
+};
+
+template <class T>
+struct is_trivially_copyable<T*>
+{
+    static const bool value = true;
+};
+
+/* ALIGNMENT OF */
+// without C++11 the alignment is the padding the compiler puts before a T
+// which follows a char
+template <class T>
+struct alignment_of
+{
+#ifdef FT_HAS_CXX11
+    static const size_t value = alignof(T);
+#else
+  private:
+    struct probe
+    {
+        char c;
+        T t;
+    };
+
+  public:
+    static const size_t value = sizeof(probe) - sizeof(T);
+#endif
+};
+
+/* ALIGNED BUFFER */
+// raw storage for N objects of type T, without C++11 there are no
+// over-aligned types & the strictest fundamental type is enough
+template <class T, size_t N>
+struct aligned_buffer
+{
+#ifdef FT_HAS_CXX11
+    alignas(T) unsigned char bytes[N * sizeof(T)];
+#else
+    union
+    {
+        unsigned char bytes[N * sizeof(T)];
+        long double align_long_double;
+        long long align_long_long;
+        void * align_pointer;
+    };
+#endif
+
+    T * data (void) { return reinterpret_cast<T*>(bytes); }
+    const T * data (void) const { return reinterpret_cast<const T*>(bytes); }
+};
+
+/* TRIVIALLY RELOCATABLE */
+// relocating an object moves it to new storage & ends the life of the
+// original, for trivially relocatable types a memcpy does both. owning
+// handles which only hold a pointer e.g unique_ptr like types are not
+// trivially copyable but can opt in by specializing this trait
+template <class T>
+struct is_trivially_relocatable
+{
+    static const bool value = is_trivially_copyable<T>::value;
+};
+
+/* NOTHROW RELOCATABLE */
+// whether the elements can be moved one by one without the risk of being
+// left halfway, the containers copy the others to their new storage &
+// only destroy the originals once every copy is built
+template <class T>
+struct is_nothrow_relocatable
+{
+#ifdef FT_HAS_CXX11
+    static const bool value = is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value;
+#else
+    static const bool value = is_trivially_relocatable<T>::value;
+#endif
+};
+
+/* KEY EXTRACTION */
+// used by the tree containers to retrieve the part of a value_type
+// which is compared i.e the whole value for sets and the key for maps
+template <class T>
+struct identity
+{
+    typedef T key_type;
+
+    const key_type& operator() (const T& x) const { return x; }
+};
+
+template <class Pair>
+struct select_first
+{
+    typedef typename Pair::first_type key_type;
+
+    const key_type& operator() (const Pair& x) const { return x.first; }
+};
+
+/* MEMBER HOOK */
+// used by the intrusive containers to go from an element to the hook
+// member they link & back. the offset of the member is read from the
+// pointer to member, which gcc, clang & msvc all represent by that offset
+// for a class without virtual bases, no object is needed to compute it
+template <class T, class Hook, Hook T::* Member>
+struct member_hook
+{
+    static Hook* to_hook (T& value) { return &(value.*Member); }
+    static T* to_value (Hook* hook) { return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - offset()); }
+    static const T* to_value (const Hook* hook) { return reinterpret_cast<const T*>(reinterpret_cast<const char*>(hook) - offset()); }
+
+    static std::ptrdiff_t offset (void)
+    {
+        Hook T::* member = Member;
+        std::ptrdiff_t ret = 0;
+        std::memcpy(&ret, &member, sizeof(member) < sizeof(ret) ? sizeof(member) : sizeof(ret));
+        return ret;
+    }
+};
+
+/* IN PLACE */
+// tag selecting the node constructors which build their content from
+// the arguments of an emplace call
+struct in_place_t
+{
+};
+
 /* SWAP */
 template <class T>
 void swap ( T& a, T& b )
 {
+#ifdef FT_HAS_CXX11
+    T c (std::move(a));
+    a = std::move(b);
+    b = std::move(c);
+#else
     T c (a);
     a = b;
     b = c;
+#endif
 }
 
 /* MAX */
@@ -48,4 +217,13 @@ T max (const T& a, const T& b)
     return b;
 }
 
+/* MIN */
+template <class T>
+T min (const T& a, const T& b)
+{
+    if (b < a)
+        return b;
+    return a;
+}
+
 } // NAMESPACE FT
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef> // size_t
+
+namespace ft {
+
+/* GROWTH POLICIES */
+// a growth policy is called by vector once its capacity is exceeded, it gets
+// the current capacity, the size which has to fit and the size of an element
+// and returns the new capacity, which vector never lets fall below the size
+
+// grows by 1.5 starting from a capacity of 1, ceil(1.5 * c) is computed
+// with integers
+struct default_growth
+{
+    size_t operator() (size_t capacity, size_t new_size, size_t) const
+    {
+        if (capacity == 0)
+            capacity = 1;
+        while (new_size > capacity)
+            capacity += (capacity + 1) / 2;
+        return capacity;
+    }
+};
+
+// fewer reallocations at the cost of up to half of the buffer being unused
+struct doubling_growth
+{
+    size_t operator() (size_t capacity, size_t new_size, size_t) const
+    {
+        if (capacity == 0)
+            capacity = 1;
+        while (new_size > capacity)
+            capacity *= 2;
+        return capacity;
+    }
+};
+
+// grows by 13/8, the closest fibonacci ratio to the golden ratio which can
+// be computed with a shift
+struct golden_growth
+{
+    size_t operator() (size_t capacity, size_t new_size, size_t) const
+    {
+        if (capacity == 0)
+            capacity = 1;
+        while (new_size > capacity)
+            capacity += (capacity * 5 + 7) / 8;
+        return capacity;
+    }
+};
+
+// rounds the capacity computed by Growth up so the buffer fills whole pages,
+// the slack would be lost to the allocator otherwise
+template <size_t PageSize = 4096, class Growth = default_growth>
+struct page_growth
+{
+    size_t operator() (size_t capacity, size_t new_size, size_t elem_size) const
+    {
+        size_t bytes = Growth()(capacity, new_size, elem_size) * elem_size;
+        bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+        return bytes / elem_size;
+    }
+};
+
+typedef page_growth<2 * 1024 * 1024> huge_page_growth;
+
+} // NAMESPACE FT
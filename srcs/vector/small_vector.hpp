@@ -0,0 +1,121 @@
+#pragma once
+
+#include "vector_base.hpp"
+#include "growth_policy.hpp"
+#include "../utils/utils.hpp"
+
+#include <cstddef> // std::ptrdiff_t, size_t, NULL
+
+#include <memory> // std::allocator
+#include <limits> // std::numeric_limits
+
+namespace ft {
+
+/* SMALL VECTOR */
+// vector keeping up to N elements in a buffer embedded in the object, the
+// allocator is only used once the size exceeds N. iterators & references
+// are invalidated by a move or a swap as inline elements have to be moved
+template < class T, size_t N, class Alloc = std::allocator<T>, class GrowthPolicy = ft::default_growth >
+class small_vector : public vector_base<T, Alloc, GrowthPolicy, N>
+{
+    public:
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef GrowthPolicy growth_policy;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef vector_iterator<value_type, false> iterator;
+        typedef vector_iterator<value_type, true> const_iterator;
+        typedef reverse_vector_iterator<value_type, false> reverse_iterator;
+        typedef reverse_vector_iterator<value_type, true> const_reverse_iterator;
+        typedef std::ptrdiff_t difference_type;
+        typedef size_t size_type;
+
+    private:
+        typedef vector_base<value_type, allocator_type, growth_policy, N> Base;
+
+    public:
+        /* CONSTRUCTORS */
+        explicit small_vector (const allocator_type& alloc = allocator_type())
+            : Base(alloc)
+        {
+        }
+
+        explicit small_vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
+            : Base(alloc)
+        {
+            Base::assign(n, val);
+        }
+
+        template <class InputIterator>
+        small_vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+            : Base(alloc)
+        {
+            Base::assign(first, last);
+        }
+
+        small_vector (const small_vector& x)
+            : Base(x._alloc)
+        {
+            *this = x;
+        }
+
+#ifdef FT_HAS_CXX11
+        // x is left empty, its elements are moved one by one if they
+        // are stored inline
+        small_vector (small_vector&& x)
+            : Base(x._alloc)
+        {
+            Base::steal(x);
+        }
+#endif
+
+        /* OPERATORS */
+        small_vector& operator= (const small_vector& x)
+        {
+            if (this != &x)
+                Base::assign(x.begin(), x.end());
+            return *this;
+        }
+
+#ifdef FT_HAS_CXX11
+        small_vector& operator= (small_vector&& x)
+        {
+            if (this != &x) {
+                Base::release();
+                Base::steal(x);
+            }
+            return *this;
+        }
+#endif
+
+        /* MODIFIERS */
+        // heap buffers are exchanged, inline elements are moved
+        void swap (small_vector& x)
+        {
+            if (!is_inline() && !x.is_inline()) {
+                Base::exchange(x);
+                return ;
+            }
+            small_vector tmp (Base::_alloc);
+            tmp.steal(*this);
+            Base::steal(x);
+            x.steal(tmp);
+        }
+
+        /* OBSERVERS */
+        // whether the elements are stored in the embedded buffer
+        bool is_inline (void) const { return Base::is_inline(); }
+
+}; // CLASS SMALL_VECTOR
+
+template <class T, size_t N, class Alloc, class GrowthPolicy>
+void swap (small_vector<T, N, Alloc, GrowthPolicy>& x, small_vector<T, N, Alloc, GrowthPolicy>& y)
+{
+    x.swap(y);
+}
+
+} // NAMESPACE FT
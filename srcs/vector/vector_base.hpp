@@ -0,0 +1,513 @@
+#pragma once
+
+#include "vector_iterator.hpp"
+#include "growth_policy.hpp"
+#include "../utils/utils.hpp"
+
+#include <cstddef> // std::ptrdiff_t, size_t, NULL
+#include <cstring> // std::memmove
+
+#include <memory> // std::allocator
+#include <stdexcept> // std::out_of_range
+#include <limits> // std::numeric_limits
+
+namespace ft {
+
+/* VECTOR STORAGE */
+// the buffer embedded in a small_vector, a vector has none & the empty
+// base takes no room in it
+template <class T, size_t N>
+struct vector_storage
+{
+    aligned_buffer<T, N> buffer;
+
+    T * inline_array (void) { return buffer.data(); }
+    const T * inline_array (void) const { return buffer.data(); }
+};
+
+template <class T>
+struct vector_storage<T, 0>
+{
+    T * inline_array (void) { return NULL; }
+    const T * inline_array (void) const { return NULL; }
+};
+
+/* VECTOR BASE */
+// the elements & every operation vector & small_vector share, the first N
+// elements are kept in the embedded buffer before the allocator is used.
+// only the constructors, the moves & swap differ between the two
+template <class T, class Alloc, class GrowthPolicy, size_t N>
+class vector_base : private vector_storage<T, N>
+{
+    public:
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef GrowthPolicy growth_policy;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef vector_iterator<value_type, false> iterator;
+        typedef vector_iterator<value_type, true> const_iterator;
+        typedef reverse_vector_iterator<value_type, false> reverse_iterator;
+        typedef reverse_vector_iterator<value_type, true> const_reverse_iterator;
+        typedef std::ptrdiff_t difference_type;
+        typedef size_t size_type;
+
+    private:
+        typedef vector_storage<T, N> Storage;
+
+    public:
+        /* CONSTRUCTORS */
+        explicit vector_base (const allocator_type& alloc = allocator_type())
+            : _size(0), _capacity(N), _array(Storage::inline_array()), _alloc(alloc)
+        {
+        }
+
+        /* OPERATORS */
+        friend bool operator== (const vector_base& lhs, const vector_base& rhs)
+        {
+            if (lhs._size != rhs._size)
+                return false;
+            for (size_type i = 0; i < lhs._size; ++i) {
+                if (lhs[i] != rhs[i])
+                    return false;
+            }
+            return true;
+        }
+
+        friend bool operator< (const vector_base& lhs, const vector_base& rhs)
+        {
+            for (size_type i = 0; i < lhs._size && i < rhs._size; ++i) {
+                if (lhs[i] < rhs[i])
+                    return true;
+                if (lhs[i] > rhs[i])
+                    return false;
+            }
+            if (lhs._size >= rhs._size)
+                return false;
+            return true;
+        }
+
+        friend bool operator!= (const vector_base& lhs, const vector_base& rhs) { return !(lhs == rhs); }
+        friend bool operator<= (const vector_base& lhs, const vector_base& rhs) { return !(rhs < lhs); }
+        friend bool operator> (const vector_base& lhs, const vector_base& rhs) { return rhs < lhs; }
+        friend bool operator>= (const vector_base& lhs, const vector_base& rhs) { return !(lhs < rhs); }
+
+        /* DESTRUCTOR */
+        ~vector_base()
+        {
+            clear();
+            if (!is_inline())
+                _alloc.deallocate(_array, _capacity);
+        }
+
+        /* ITERATORS */
+        iterator begin() { return iterator(0, _array); }
+        const_iterator begin() const { return const_iterator(0, _array); }
+        iterator end() { return iterator(_size, _array); }
+        const_iterator end() const { return const_iterator(_size, _array); }
+        reverse_iterator rbegin() { return reverse_iterator(_size - 1, _array); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(_size - 1, _array); }
+        reverse_iterator rend() { return reverse_iterator(-1, _array); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(-1, _array); }
+
+        /* CAPACITY */
+        size_type size() const { return _size; }
+        size_type max_size() const { return _alloc.max_size(); }
+
+        void resize (size_type n, value_type val = value_type())
+        {
+            if (n > _size) {
+                push_back_n(n - _size, val);
+            } else {
+                while (n < _size)
+                    pop_back();
+            }
+        }
+
+        size_type capacity() const { return _capacity; }
+        bool empty() const { return _size == 0; }
+
+        void reserve (size_type n)
+        {
+            if (n > _capacity)
+                realloc(n);
+        }
+
+        /* ELEMENT ACCESS */
+        reference front () { return _array[0]; }
+        const_reference front () const { return _array[0]; }
+        reference back () { return _array[_size - 1]; }
+        const_reference back () const { return _array[_size - 1]; }
+
+        reference at (size_type n)
+        {
+            if (n >= _size)
+                throw std::out_of_range("ft::vector");
+            return _array[n];
+        }
+
+        const_reference at (size_type n) const
+        {
+            if (n >= _size)
+                throw std::out_of_range("ft::vector");
+            return _array[n];
+        }
+
+        reference operator[] (size_type n) { return _array[n]; }
+        const_reference operator[] (size_type n) const { return _array[n]; }
+
+        /* MODIFIERS */
+        template <class InputIterator>
+        void assign (InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+        {
+            clear();
+            insert(begin(), first, last);
+        }
+
+        void assign(size_type n, const value_type& val)
+        {
+            clear();
+            insert(begin(), n, val);
+        }
+
+        void push_back (const value_type& val)
+        {
+            push_back_n(1, val);
+        }
+
+#ifdef FT_HAS_CXX11
+        void push_back (value_type&& val)
+        {
+            emplace_back(std::move(val));
+        }
+
+        template <class... Args>
+        void emplace_back (Args&&... args)
+        {
+            if (_size == _capacity) {
+                // args may refer to an element which is about to be relocated
+                value_type tmp (std::forward<Args>(args)...);
+                realloc(_size + 1);
+                _alloc.construct(_array + _size, std::move(tmp));
+            } else {
+                _alloc.construct(_array + _size, std::forward<Args>(args)...);
+            }
+            ++_size;
+        }
+#endif
+
+        void pop_back (void)
+        {
+            --_size;
+            _alloc.destroy(_array + _size);
+        }
+
+        iterator insert (iterator position, const value_type& val)
+        {
+            insert(position, 1, val);
+            return iterator(position.get_index(), _array);
+        }
+
+#ifdef FT_HAS_CXX11
+        iterator insert (iterator position, value_type&& val)
+        {
+            return emplace(position, std::move(val));
+        }
+
+        // the new element is built before the gap is opened since args
+        // may refer to an element of the vector
+        template <class... Args>
+        iterator emplace (iterator position, Args&&... args)
+        {
+            size_type i = position.get_index();
+            if (i == _size) {
+                emplace_back(std::forward<Args>(args)...);
+            } else {
+                value_type tmp (std::forward<Args>(args)...);
+                move_builder build = { tmp };
+                insert_gap(i, 1, build);
+            }
+            return iterator(i, _array);
+        }
+#endif
+
+        void insert (iterator position, size_type n, const value_type& val)
+        {
+            if (n == 0)
+                return ;
+            // val may refer to an element which is about to be shifted
+            value_type copy (val);
+            fill_builder build = { copy };
+            insert_gap(position.get_index(), n, build);
+        }
+
+        template <class InputIterator>
+        void insert (iterator position, InputIterator first, InputIterator last,
+              typename ft::enable_if< !std::numeric_limits<InputIterator>::is_integer , void >::type* = 0)
+        {
+            size_type n = std::distance(first, last);
+            if (n == 0)
+                return ;
+            range_builder<InputIterator> build = { first };
+            insert_gap(position.get_index(), n, build);
+        }
+
+        iterator erase (iterator position)
+        {
+            iterator next = position;
+            ++next;
+            return erase(position, next);
+        }
+
+        iterator erase (iterator first, iterator last)
+        {
+            if (first == last)
+                return first;
+            size_type i = first.get_index();
+            size_type j = last.get_index();
+            destroy_range(i, j);
+            relocate(_array + i, _array + j, _size - j);
+            _size -= j - i;
+            return iterator(i, _array);
+        }
+
+        void clear(void)
+        {
+            destroy_range(0, _size);
+            _size = 0;
+        }
+
+    protected:
+        size_type _size;
+        size_type _capacity;
+        value_type * _array;
+        allocator_type _alloc;
+
+        // whether the elements are stored in the embedded buffer, an empty
+        // vector which never allocated counts as inline
+        bool is_inline (void) const { return _array == Storage::inline_array(); }
+
+        // exchanges the buffers, neither may be an embedded one
+        void exchange (vector_base& x)
+        {
+            ft::swap(_size, x._size);
+            ft::swap(_capacity, x._capacity);
+            ft::swap(_array, x._array);
+            ft::swap(_alloc, x._alloc);
+        }
+
+        // destroys the elements & returns to the inline buffer
+        void release (void)
+        {
+            clear();
+            if (!is_inline())
+                _alloc.deallocate(_array, _capacity);
+            _array = Storage::inline_array();
+            _capacity = N;
+        }
+
+        // takes the elements of x, *this has to be empty & inline,
+        // x is left empty & inline
+        void steal (vector_base& x)
+        {
+            if (x.is_inline()) {
+                relocate(_array, x._array, x._size);
+            } else {
+                _array = x._array;
+                _capacity = x._capacity;
+                x._array = x.Storage::inline_array();
+                x._capacity = N;
+            }
+            _size = x._size;
+            x._size = 0;
+        }
+
+    private:
+        // the size only counts the elements once they are built
+        void push_back_n (size_type n, const value_type & val = value_type())
+        {
+            reserve(_size + n);
+            for (size_type i = 0; i < n; ++i, ++_size)
+                _alloc.construct(_array + _size, val);
+        }
+
+        size_type grow_capacity (size_type new_size) const
+        {
+            return ft::max(growth_policy()(_capacity, new_size, sizeof(value_type)), new_size);
+        }
+
+        void realloc(size_type new_size)
+        {
+            size_type new_capacity = grow_capacity(new_size);
+            new_buffer buf = { *this, _alloc.allocate(new_capacity), new_capacity, _size, 0, 0, 0 };
+            adopt(buf);
+        }
+
+        /* GAPS */
+        // builders construct the elements insert_gap puts in a gap
+        struct fill_builder
+        {
+            const value_type& val;
+
+            void operator() (allocator_type& alloc, value_type * dst) { alloc.construct(dst, val); }
+        };
+
+        template <class InputIterator>
+        struct range_builder
+        {
+            InputIterator it;
+
+            void operator() (allocator_type& alloc, value_type * dst) { alloc.construct(dst, *it); ++it; }
+        };
+
+#ifdef FT_HAS_CXX11
+        struct move_builder
+        {
+            value_type& val;
+
+            void operator() (allocator_type& alloc, value_type * dst) { alloc.construct(dst, std::move(val)); }
+        };
+#endif
+
+        // the gap insert_gap opened in place, if building an element throws
+        // the ones already built are destroyed & the tail moves back over it
+        struct gap_guard
+        {
+            vector_base& vec;
+            size_type pos;
+            size_type n;
+            size_type built;
+
+            ~gap_guard()
+            {
+                if (built == n)
+                    return ;
+                for (size_type i = 0; i < built; ++i)
+                    vec._alloc.destroy(vec._array + pos + i);
+                vec.relocate(vec._array + pos, vec._array + pos + n, vec._size - pos);
+            }
+        };
+
+        // a buffer with a gap of n slots at pos, the elements built in the
+        // gap & the ones copied around it are destroyed & the buffer is
+        // freed unless adopt took it
+        struct new_buffer
+        {
+            vector_base& vec;
+            value_type * array;
+            size_type capacity;
+            size_type pos;
+            size_type n;
+            size_type built;
+            size_type copied;
+
+            ~new_buffer()
+            {
+                if (!array)
+                    return ;
+                for (size_type i = 0; i < built; ++i)
+                    vec._alloc.destroy(array + pos + i);
+                for (size_type i = 0; i < copied; ++i)
+                    vec._alloc.destroy(array + (i < pos ? i : i + n));
+                vec._alloc.deallocate(array, capacity);
+            }
+        };
+
+        // builds n elements with build in a gap at pos. the elements which
+        // follow are shifted in place if they fit & can't throw while moved,
+        // otherwise the new ones are built in a new buffer before the others
+        // are moved to it. either way a throwing build leaves the vector as
+        // it was
+        template <class Build>
+        void insert_gap (size_type pos, size_type n, Build build)
+        {
+            bool fits = _size + n <= _capacity;
+            if (fits && (pos == _size || ft::is_nothrow_relocatable<value_type>::value)) {
+                relocate(_array + pos + n, _array + pos, _size - pos);
+                gap_guard gap = { *this, pos, n, 0 };
+                for (; gap.built < n; ++gap.built)
+                    build(_alloc, _array + pos + gap.built);
+                _size += n;
+                return ;
+            }
+            size_type new_capacity = fits ? _capacity : grow_capacity(_size + n);
+            new_buffer buf = { *this, _alloc.allocate(new_capacity), new_capacity, pos, n, 0, 0 };
+            for (; buf.built < n; ++buf.built)
+                build(_alloc, buf.array + pos + buf.built);
+            adopt(buf);
+        }
+
+        // moves the elements around the gap of buf into it & makes it the
+        // buffer of the vector, the elements of the gap are counted. the
+        // ones which may throw while moved are all copied before the
+        // originals are destroyed, a throwing copy leaves them untouched
+        void adopt (new_buffer& buf)
+        {
+            if (ft::is_nothrow_relocatable<value_type>::value) {
+                relocate(buf.array, _array, buf.pos);
+                relocate(buf.array + buf.pos + buf.n, _array + buf.pos, _size - buf.pos);
+            } else {
+                for (; buf.copied < _size; ++buf.copied) {
+                    size_type i = buf.copied;
+#ifdef FT_HAS_CXX11
+                    _alloc.construct(buf.array + (i < buf.pos ? i : i + buf.n), std::move_if_noexcept(_array[i]));
+#else
+                    _alloc.construct(buf.array + (i < buf.pos ? i : i + buf.n), _array[i]);
+#endif
+                }
+                destroy_range(0, _size);
+            }
+            if (!is_inline())
+                _alloc.deallocate(_array, _capacity);
+            _array = buf.array;
+            _capacity = buf.capacity;
+            _size += buf.n;
+            buf.array = NULL;
+        }
+
+        // moves n elements from src to the unconstructed slots at dst,
+        // the ranges may overlap
+        void relocate (value_type * dst, value_type * src, size_type n)
+        {
+            if (n == 0 || dst == src)
+                return ;
+            if (ft::is_trivially_relocatable<value_type>::value) {
+                std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+            } else if (dst < src) {
+                for (size_type i = 0; i < n; ++i)
+                    relocate_one(dst + i, src + i);
+            } else {
+                for (size_type i = n; i > 0; --i)
+                    relocate_one(dst + i - 1, src + i - 1);
+            }
+        }
+
+        void relocate_one (value_type * dst, value_type * src)
+        {
+#ifdef FT_HAS_CXX11
+            _alloc.construct(dst, std::move_if_noexcept(*src));
+#else
+            _alloc.construct(dst, *src);
+#endif
+            _alloc.destroy(src);
+        }
+
+        // trivially copyable types have nothing to destroy
+        void destroy_range (size_type first, size_type last)
+        {
+            if (ft::is_trivially_copyable<value_type>::value)
+                return ;
+            for (; first < last; ++first)
+                _alloc.destroy(_array + first);
+        }
+
+        // copying is up to vector & small_vector
+        vector_base (const vector_base&);
+        vector_base& operator= (const vector_base&);
+
+}; // CLASS VECTOR_BASE
+
+} // NAMESPACE FT
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../utils/utils.hpp"
+#include "../utils/algorithm.hpp" // contiguous_iterator_traits
 #include <cstddef> // NULL, std::ptrdiff_t, size_t
 #include <iterator> // std::random_access_iterator_tag
 
@@ -122,6 +123,16 @@ class vector_iterator
 
 }; // CLASS VECTOR_ITERATOR
 
+template <class T, bool is_const>
+struct contiguous_iterator_traits< vector_iterator<T, is_const> >
+{
+    static const bool is_contiguous = true;
+
+    typedef T value_type;
+
+    static const T* address (const vector_iterator<T, is_const>& it) { return it.get_array() + it.get_index(); }
+};
+
 template <class T, bool is_const>
 class reverse_vector_iterator
 {
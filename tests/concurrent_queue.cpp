@@ -0,0 +1,294 @@
+#include "../srcs/concurrent_queue/concurrent_queue.hpp"
+#include "catch.hpp"
+#include <string>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+
+// ft::concurrent_queue has no stl counterpart & needs C++11 atomics
+#if !defined(VERIFY_UNIT_TESTS) && defined(FT_HAS_CXX11)
+
+static std::string make_string (int i)
+{
+    return std::string(20, 'a' + i % 26) + std::to_string(i);
+}
+
+TEST_CASE("concurrent_queue behaves like a bounded fifo on a single thread", "[concurrent_queue][modifiers]")
+{
+    ft::concurrent_queue<std::string> q (5);
+    std::string out;
+    REQUIRE( q.capacity() == 8 );
+    REQUIRE( q.empty() );
+    REQUIRE_FALSE( q.try_pop(out) );
+
+    int pushed = 0;
+    int popped = 0;
+    for (int round = 0; round < 20; ++round) {
+        while (q.try_push(make_string(pushed)))
+            ++pushed;
+        REQUIRE( q.size() == 8 );
+        for (int i = 0; i < round % 8 + 1; ++i) {
+            REQUIRE( q.try_pop(out) );
+            REQUIRE( out == make_string(popped++) );
+        }
+    }
+    ft::vector<std::string> bulk (1, "first");
+    REQUIRE( q.pop_bulk(bulk, 3) == 3 );
+    REQUIRE( q.pop_bulk(bulk, 0) == 0 );
+    REQUIRE( q.pop_bulk(bulk, 100) == static_cast<size_t>(pushed - popped - 3) );
+    REQUIRE( bulk.front() == "first" );
+    for (size_t i = 1; i < bulk.size(); ++i)
+        REQUIRE( bulk[i] == make_string(popped++) );
+    REQUIRE( q.empty() );
+    REQUIRE( q.pop_bulk(bulk, 100) == 0 );
+
+    // blocking calls return at once when they can proceed
+    q.push("x");
+    q.pop(out);
+    REQUIRE( out == "x" );
+
+    // the elements left in the queue are destroyed with it
+    ft::concurrent_queue< std::unique_ptr<int> > owners (4);
+    for (int i = 0; i < 3; ++i)
+        REQUIRE( owners.try_emplace(new int(i)) );
+    std::unique_ptr<int> owner;
+    REQUIRE( owners.try_pop(owner) );
+    REQUIRE( *owner == 0 );
+}
+
+// moving one out throws once moves_left reaches 0
+struct fragile_move
+{
+    static int moves_left;
+    static int alive;
+    int n;
+
+    fragile_move (int n) : n(n) { ++alive; }
+    fragile_move (const fragile_move& x) : n(x.n) { ++alive; }
+    fragile_move (fragile_move&& x) : n(x.n)
+    {
+        if (moves_left-- == 0)
+            throw std::runtime_error("fragile_move");
+        ++alive;
+    }
+    ~fragile_move() { --alive; }
+};
+
+int fragile_move::moves_left = 0;
+int fragile_move::alive = 0;
+
+TEST_CASE("concurrent_queue pop_bulk releases every claimed cell when a move throws", "[concurrent_queue][modifiers]")
+{
+    {
+        ft::concurrent_queue<fragile_move> q (4);
+        for (int i = 0; i < 4; ++i)
+            REQUIRE( q.try_emplace(i) );
+        ft::vector<fragile_move> out;
+        fragile_move::moves_left = 1;
+        REQUIRE_THROWS_AS( q.pop_bulk(out, 4), std::runtime_error );
+        REQUIRE( out.size() == 1 );
+        REQUIRE( out[0].n == 0 );
+        REQUIRE( q.empty() );
+        REQUIRE( fragile_move::alive == 1 );
+
+        fragile_move::moves_left = 100;
+        for (int i = 0; i < 4; ++i)
+            REQUIRE( q.try_emplace(i) );
+        REQUIRE( q.pop_bulk(out, 4) == 4 );
+        REQUIRE( out.back().n == 3 );
+    }
+    REQUIRE( fragile_move::alive == 0 );
+}
+
+// building one from an int throws once builds_left reaches 0, assigning
+// one out once assigns_left does
+struct touchy_value
+{
+    static int builds_left;
+    static int assigns_left;
+    static int alive;
+    int n;
+
+    touchy_value (void) : n(-1) { ++alive; }
+    touchy_value (int i) : n(i)
+    {
+        if (builds_left-- == 0)
+            throw std::runtime_error("touchy_value");
+        ++alive;
+    }
+    touchy_value (const touchy_value& x) : n(x.n) { ++alive; }
+    touchy_value& operator= (const touchy_value& x)
+    {
+        if (assigns_left-- == 0)
+            throw std::runtime_error("touchy_value");
+        n = x.n;
+        return *this;
+    }
+    ~touchy_value() { --alive; }
+};
+
+int touchy_value::builds_left = 0;
+int touchy_value::assigns_left = 0;
+int touchy_value::alive = 0;
+
+TEST_CASE("concurrent_queue hands on the cells whose element throws", "[concurrent_queue][modifiers]")
+{
+    touchy_value::builds_left = 1000;
+    touchy_value::assigns_left = 1000;
+    {
+        ft::concurrent_queue<touchy_value> q (4);
+        touchy_value out;
+        SECTION("a push which throws leaves an empty cell the pops skip") {
+            REQUIRE( q.try_emplace(0) );
+            touchy_value::builds_left = 0;
+            REQUIRE_THROWS_AS( q.try_emplace(1), std::runtime_error );
+            touchy_value::builds_left = 1000;
+            REQUIRE( q.try_emplace(2) );
+            REQUIRE( q.try_pop(out) );
+            REQUIRE( out.n == 0 );
+            REQUIRE( q.try_pop(out) );
+            REQUIRE( out.n == 2 );
+        }
+        SECTION("pop_bulk skips the empty cells") {
+            REQUIRE( q.try_emplace(0) );
+            touchy_value::builds_left = 0;
+            REQUIRE_THROWS_AS( q.try_emplace(1), std::runtime_error );
+            touchy_value::builds_left = 1000;
+            REQUIRE( q.try_emplace(2) );
+            ft::vector<touchy_value> outs;
+            REQUIRE( q.pop_bulk(outs, 4) == 2 );
+            REQUIRE( outs[1].n == 2 );
+        }
+        SECTION("a pop which throws frees its cell") {
+            REQUIRE( q.try_emplace(0) );
+            REQUIRE( q.try_emplace(1) );
+            touchy_value::assigns_left = 0;
+            REQUIRE_THROWS_AS( q.try_pop(out), std::runtime_error );
+            touchy_value::assigns_left = 1000;
+            REQUIRE( q.try_pop(out) );
+            REQUIRE( out.n == 1 );
+        }
+        REQUIRE_FALSE( q.try_pop(out) );
+        REQUIRE( q.empty() );
+        for (int i = 0; i < 4; ++i)
+            REQUIRE( q.try_emplace(i) );
+        REQUIRE_FALSE( q.try_emplace(4) );
+        REQUIRE( touchy_value::alive == 5 );
+    }
+    REQUIRE( touchy_value::alive == 0 );
+}
+
+TEST_CASE("concurrent_queue wakes the pushers waiting on skipped cells", "[concurrent_queue][threads]")
+{
+    touchy_value::builds_left = 1000;
+    touchy_value::assigns_left = 1000;
+    {
+        // every cell is claimed by a push which threw
+        ft::concurrent_queue<touchy_value> q (2);
+        for (int i = 0; i < 2; ++i) {
+            touchy_value::builds_left = 0;
+            REQUIRE_THROWS_AS( q.try_emplace(i), std::runtime_error );
+        }
+        touchy_value::builds_left = 1000;
+        REQUIRE_FALSE( q.try_emplace(2) );
+
+        std::thread pusher ([&q]() { q.emplace(3); });
+        touchy_value out;
+        q.pop(out);
+        pusher.join();
+        REQUIRE( out.n == 3 );
+        REQUIRE( q.empty() );
+    }
+    REQUIRE( touchy_value::alive == 0 );
+}
+
+// every producer sends its own increasing sequence, each consumer must see
+// the messages of a producer in order & all of them must arrive once
+TEST_CASE("concurrent_queue between many producers & consumers", "[concurrent_queue][threads]")
+{
+    static const int producers = 4;
+    static const int consumers = 4;
+    static const int n = 20000;
+    ft::concurrent_queue<int> q (64);
+    std::atomic<long> sum (0);
+    std::atomic<int> received (0);
+    std::atomic<bool> ordered (true);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.push_back(std::thread([&q, p]() {
+            for (int i = 0; i < n; ++i) {
+                int msg = p * n + i;
+                if (i % 2 == 0)
+                    q.push(msg);
+                else {
+                    while (!q.try_push(msg))
+                        std::this_thread::yield();
+                }
+            }
+        }));
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.push_back(std::thread([&q, &sum, &received, &ordered, c]() {
+            int last[producers] = { -1, -1, -1, -1 };
+            ft::vector<int> bulk;
+            long local = 0;
+            for (;;) {
+                if (received.load() >= producers * n)
+                    break ;
+                bulk.clear();
+                if (c % 2 == 0)
+                    q.pop_bulk(bulk, 16);
+                else {
+                    int msg;
+                    if (q.try_pop(msg))
+                        bulk.push_back(msg);
+                }
+                if (bulk.empty())
+                    std::this_thread::yield();
+                for (size_t i = 0; i < bulk.size(); ++i) {
+                    int p = bulk[i] / n;
+                    if (bulk[i] % n <= last[p])
+                        ordered = false;
+                    last[p] = bulk[i] % n;
+                    local += bulk[i];
+                }
+                received += bulk.size();
+            }
+            sum += local;
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); ++i)
+        threads[i].join();
+
+    long total = producers * n;
+    REQUIRE( ordered.load() );
+    REQUIRE( received.load() == total );
+    REQUIRE( sum.load() == total * (total - 1) / 2 );
+    REQUIRE( q.empty() );
+}
+
+TEST_CASE("concurrent_queue blocking calls park until they can proceed", "[concurrent_queue][threads]")
+{
+    static const int n = 50000;
+    ft::concurrent_queue<int> q (2);
+
+    // a tiny queue keeps both sides parking on each other
+    std::thread producer ([&q]() {
+        for (int i = 0; i < n; ++i)
+            q.push(i);
+    });
+    bool ordered = true;
+    for (int i = 0; i < n; ++i) {
+        int val;
+        q.pop(val);
+        ordered = ordered && val == i;
+    }
+    producer.join();
+    REQUIRE( ordered );
+    REQUIRE( q.empty() );
+}
+
+#endif
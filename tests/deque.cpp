@@ -1,7 +1,15 @@
 #include "../srcs/deque/deque.hpp"
+#include "../srcs/vector/vector.hpp"
 #include "catch.hpp"
 #include <deque>
 #include <list>
+#include <vector>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
 
 #ifdef VERIFY_UNIT_TESTS
 # define LIB std
@@ -576,3 +584,643 @@ TEMPLATE_PRODUCT_TEST_CASE("size deque", "[deque][capacity]", LIB::deque, TYPE_L
     dq.clear();
     CHECK( dq.size() == 0 );
 }
+
+TEST_CASE("move & emplace deque", "[deque][modifiers]")
+{
+    SECTION("move construction & assignment leave the source empty") {
+        LIB::deque<std::string> src (100, "forty two");
+        LIB::deque<std::string> dst (std::move(src));
+        REQUIRE( src.empty() );
+        REQUIRE( dst.size() == 100 );
+
+        src.push_back("reused");
+        REQUIRE( src.front() == "reused" );
+        src = std::move(dst);
+        REQUIRE( src.size() == 100 );
+        REQUIRE( src.back() == "forty two" );
+    }
+    SECTION("move only types can be pushed & emplaced at both ends & in the middle") {
+        LIB::deque<std::unique_ptr<int> > cnt;
+        std::deque<int> stl_cnt;
+        for (int i = 0; i < 100; ++i) {
+            cnt.emplace_back(new int(i));
+            cnt.push_front(std::unique_ptr<int>(new int(-i)));
+            stl_cnt.push_back(i);
+            stl_cnt.push_front(-i);
+        }
+        for (int i = 0; i < 200; i += 37) {
+            cnt.emplace(cnt.begin() + i, new int(1000 + i));
+            stl_cnt.insert(stl_cnt.begin() + i, 1000 + i);
+        }
+        cnt.insert(cnt.end() - 1, std::unique_ptr<int>(new int(-1000)));
+        stl_cnt.insert(stl_cnt.end() - 1, -1000);
+        REQUIRE( cnt.size() == stl_cnt.size() );
+        for (size_t i = 0; i < stl_cnt.size(); ++i)
+            REQUIRE( *cnt[i] == stl_cnt[i] );
+    }
+}
+
+// written before move semantics, a deque can only copy it around & the
+// copies may throw
+struct legacy_string
+{
+    static int copies_left;
+    static int alive;
+    std::string s;
+
+    legacy_string (const std::string& str = std::string()) : s(str) { ++alive; }
+    legacy_string (const legacy_string& x) : s(x.s)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("legacy_string");
+        ++alive;
+    }
+    legacy_string& operator= (const legacy_string& x)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("legacy_string");
+        s = x.s;
+        return *this;
+    }
+    ~legacy_string() { --alive; }
+
+    friend bool operator== (const legacy_string& lhs, const legacy_string& rhs) { return lhs.s == rhs.s; }
+};
+
+int legacy_string::copies_left = 1 << 30;
+int legacy_string::alive = 0;
+
+template <class T> T make_value (int i);
+template <> inline int make_value<int> (int i) { return i; }
+template <> inline std::string make_value<std::string> (int i) { return std::to_string(i); }
+template <> inline legacy_string make_value<legacy_string> (int i) { return legacy_string(std::to_string(i)); }
+
+TEMPLATE_TEST_CASE("erase across chunks matches the stl", "[deque][modifiers]", int, std::string, legacy_string)
+{
+    LIB::deque<TestType> my_cnt;
+    std::deque<TestType> stl_cnt;
+    for (int i = 0; i < 300; ++i) {
+        my_cnt.push_back(make_value<TestType>(i));
+        stl_cnt.push_front(make_value<TestType>(i));
+        my_cnt.push_front(make_value<TestType>(-i));
+        stl_cnt.push_back(make_value<TestType>(-i));
+    }
+    REQUIRE( std::equal(stl_cnt.rbegin(), stl_cnt.rend(), my_cnt.begin()) );
+    std::reverse(stl_cnt.begin(), stl_cnt.end());
+
+    size_t first = GENERATE(0, 5, 33, 250, 599);
+    size_t n = GENERATE(0, 1, 31, 70, 200);
+    n = std::min(n, stl_cnt.size() - first);
+    my_cnt.erase(my_cnt.begin() + first, my_cnt.begin() + first + n);
+    stl_cnt.erase(stl_cnt.begin() + first, stl_cnt.begin() + first + n);
+    REQUIRE( my_cnt.size() == stl_cnt.size() );
+    REQUIRE( std::equal(stl_cnt.begin(), stl_cnt.end(), my_cnt.begin()) );
+}
+
+TEMPLATE_TEST_CASE("insert across chunks matches the stl", "[deque][modifiers]", int, std::string, legacy_string)
+{
+    LIB::deque<TestType> my_cnt;
+    std::deque<TestType> stl_cnt;
+    for (int i = 0; i < 1500; ++i) {
+        my_cnt.push_back(make_value<TestType>(i));
+        stl_cnt.push_back(make_value<TestType>(i));
+        my_cnt.push_front(make_value<TestType>(-i));
+        stl_cnt.push_front(make_value<TestType>(-i));
+    }
+
+    size_t position = GENERATE(0, 7, 1000, 1499, 2900, 3000);
+    size_t n = GENERATE(1, 3, 700, 2500);
+    SECTION("fill insert") {
+        // the value refers to an element which is shifted
+        TestType val = stl_cnt[1500];
+        my_cnt.insert(my_cnt.begin() + position, n, my_cnt[1500]);
+        stl_cnt.insert(stl_cnt.begin() + position, n, val);
+    }
+    SECTION("range insert") {
+        std::list<TestType> src;
+        for (size_t i = 0; i < n; ++i)
+            src.push_back(make_value<TestType>(100000 + i));
+        my_cnt.insert(my_cnt.begin() + position, src.begin(), src.end());
+        stl_cnt.insert(stl_cnt.begin() + position, src.begin(), src.end());
+    }
+    SECTION("single insert") {
+        for (size_t i = 0; i < n && i < 50; ++i) {
+            size_t at = (position + i * 61) % (stl_cnt.size() + 1);
+            REQUIRE( *my_cnt.insert(my_cnt.begin() + at, make_value<TestType>(-7)) == make_value<TestType>(-7) );
+            stl_cnt.insert(stl_cnt.begin() + at, make_value<TestType>(-7));
+        }
+    }
+    REQUIRE( my_cnt.size() == stl_cnt.size() );
+    REQUIRE( std::equal(stl_cnt.begin(), stl_cnt.end(), my_cnt.begin()) );
+    REQUIRE( std::equal(stl_cnt.rbegin(), stl_cnt.rend(), my_cnt.rbegin()) );
+}
+
+TEST_CASE("deque keeps its elements when a copy throws", "[deque][modifiers]")
+{
+    legacy_string::copies_left = 1 << 30;
+    {
+        LIB::deque<legacy_string> cnt;
+        for (int i = 0; i < 1000; ++i)
+            cnt.push_back(make_value<legacy_string>(i));
+        legacy_string val = make_value<legacy_string>(-1);
+        std::vector<legacy_string> src (5, val);
+
+        size_t position = GENERATE(3, 500, 996);
+        int copies = GENERATE(0, 2);
+        SECTION("fill insert") {
+            legacy_string::copies_left = copies;
+            REQUIRE_THROWS_AS( cnt.insert(cnt.begin() + position, 5, val), std::runtime_error );
+        }
+        SECTION("range insert") {
+            legacy_string::copies_left = copies;
+            REQUIRE_THROWS_AS( cnt.insert(cnt.begin() + position, src.begin(), src.end()), std::runtime_error );
+        }
+        SECTION("erase") {
+            legacy_string::copies_left = copies;
+            REQUIRE_THROWS_AS( cnt.erase(cnt.begin() + position, cnt.begin() + position + 1), std::runtime_error );
+        }
+        REQUIRE( legacy_string::alive == static_cast<int>(cnt.size() + src.size() + 1) );
+        legacy_string::copies_left = 1 << 30;
+#ifndef VERIFY_UNIT_TESTS
+        REQUIRE( cnt.size() == 1000 );
+        for (int i = 0; i < 1000; ++i)
+            REQUIRE( cnt[i] == make_value<legacy_string>(i) );
+#endif
+        size_t size = cnt.size();
+        cnt.insert(cnt.begin() + position, src.begin(), src.end());
+        cnt.erase(cnt.begin() + 1);
+        REQUIRE( cnt.size() == size + 4 );
+        REQUIRE( cnt[position - 1] == val );
+    }
+    REQUIRE( legacy_string::alive == 0 );
+}
+
+// moved without a throw but copied with one
+struct brittle_string
+{
+    static int copies_left;
+    static int alive;
+    std::string s;
+
+    brittle_string (const std::string& str = std::string()) : s(str) { ++alive; }
+    brittle_string (const brittle_string& x) : s(x.s)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("brittle_string");
+        ++alive;
+    }
+    brittle_string (brittle_string&& x) noexcept : s(std::move(x.s)) { ++alive; }
+    brittle_string& operator= (const brittle_string& x)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("brittle_string");
+        s = x.s;
+        return *this;
+    }
+    brittle_string& operator= (brittle_string&& x) noexcept { s = std::move(x.s); return *this; }
+    ~brittle_string() { --alive; }
+};
+
+int brittle_string::copies_left = 0;
+int brittle_string::alive = 0;
+
+TEST_CASE("deque insert leaves no hole when a copy throws", "[deque][modifiers]")
+{
+    brittle_string::copies_left = 1 << 30;
+    {
+        LIB::deque<brittle_string> cnt;
+        for (int i = 0; i < 1000; ++i)
+            cnt.push_back(brittle_string(std::to_string(i)));
+        brittle_string val ("x");
+        std::vector<brittle_string> src (5, val);
+
+        size_t position = GENERATE(0, 8, 500, 995, 1000);
+        SECTION("fill insert") {
+            brittle_string::copies_left = 3;
+            REQUIRE_THROWS_AS( cnt.insert(cnt.begin() + position, 5, val), std::runtime_error );
+        }
+        SECTION("range insert") {
+            brittle_string::copies_left = 2;
+            REQUIRE_THROWS_AS( cnt.insert(cnt.begin() + position, src.begin(), src.end()), std::runtime_error );
+        }
+        REQUIRE( brittle_string::alive == static_cast<int>(cnt.size() + src.size() + 1) );
+        brittle_string::copies_left = 1 << 30;
+#ifndef VERIFY_UNIT_TESTS
+        REQUIRE( cnt.size() == 1000 );
+        for (int i = 0; i < 1000; ++i)
+            REQUIRE( cnt[i].s == std::to_string(i) );
+#endif
+        size_t size = cnt.size();
+        cnt.insert(cnt.begin() + position, 5, val);
+        REQUIRE( cnt.size() == size + 5 );
+        REQUIRE( cnt[position].s == "x" );
+    }
+    REQUIRE( brittle_string::alive == 0 );
+}
+
+TEST_CASE("deque keeps working while its map grows & recenters", "[deque][modifiers]")
+{
+    LIB::deque<int> my_cnt;
+    std::deque<int> stl_cnt;
+
+    SECTION("sliding window pushing at the back & popping at the front") {
+        for (int round = 0; round < 50; ++round) {
+            for (int i = 0; i < 1000; ++i) {
+                my_cnt.push_back(round * 1000 + i);
+                stl_cnt.push_back(round * 1000 + i);
+            }
+            for (int i = 0; i < 900; ++i) {
+                my_cnt.pop_front();
+                stl_cnt.pop_front();
+            }
+        }
+    }
+    SECTION("sliding window pushing at the front & popping at the back") {
+        for (int round = 0; round < 50; ++round) {
+            for (int i = 0; i < 1000; ++i) {
+                my_cnt.push_front(round * 1000 + i);
+                stl_cnt.push_front(round * 1000 + i);
+            }
+            for (int i = 0; i < 900; ++i) {
+                my_cnt.pop_back();
+                stl_cnt.pop_back();
+            }
+        }
+    }
+    SECTION("growing at both ends") {
+        for (int i = 0; i < 20000; ++i) {
+            my_cnt.push_front(-i);
+            stl_cnt.push_front(-i);
+            if (i % 3 == 0) {
+                my_cnt.push_back(i);
+                stl_cnt.push_back(i);
+            }
+        }
+        my_cnt.clear();
+        stl_cnt.clear();
+        for (int i = 0; i < 5000; ++i) {
+            my_cnt.push_back(i);
+            stl_cnt.push_back(i);
+        }
+    }
+    REQUIRE( my_cnt.size() == stl_cnt.size() );
+    REQUIRE( std::equal(stl_cnt.begin(), stl_cnt.end(), my_cnt.begin()) );
+    REQUIRE( my_cnt.front() == stl_cnt.front() );
+    REQUIRE( my_cnt.back() == stl_cnt.back() );
+}
+
+#ifndef VERIFY_UNIT_TESTS
+TEST_CASE("chunk policies size the chunks", "[deque][basics]")
+{
+    REQUIRE( ft::deque<int>::chunk_size == 4096 / sizeof(int) );
+    REQUIRE( (ft::deque<char, std::allocator<char>, ft::chunk_bytes<512> >::chunk_size) == 512 );
+    REQUIRE( (ft::deque<int, std::allocator<int>, ft::chunk_elements<32> >::chunk_size) == 32 );
+    REQUIRE( (ft::deque<int, std::allocator<int>, ft::chunk_elements<1> >::chunk_size) == 2 );
+    REQUIRE( (ft::deque<int, std::allocator<int>, ft::chunk_bytes<4> >::chunk_size) == 2 );
+}
+
+TEMPLATE_TEST_CASE("deques with any chunk size match the stl", "[deque][modifiers]",
+                   (ft::deque<std::string, std::allocator<std::string>, ft::chunk_elements<2> >),
+                   (ft::deque<std::string, std::allocator<std::string>, ft::chunk_elements<3> >),
+                   (ft::deque<std::string, std::allocator<std::string>, ft::chunk_bytes<256> >),
+                   (ft::deque<std::string, std::allocator<std::string>, ft::chunk_bytes<> >))
+{
+    TestType my_cnt;
+    std::deque<std::string> stl_cnt;
+    for (int i = 0; i < 500; ++i) {
+        my_cnt.push_back(std::to_string(i));
+        stl_cnt.push_back(std::to_string(i));
+        my_cnt.push_front(std::to_string(-i));
+        stl_cnt.push_front(std::to_string(-i));
+        if (i % 4 == 0) {
+            my_cnt.pop_front();
+            stl_cnt.pop_front();
+        }
+    }
+    my_cnt.erase(my_cnt.begin() + 10, my_cnt.begin() + 100);
+    stl_cnt.erase(stl_cnt.begin() + 10, stl_cnt.begin() + 100);
+    my_cnt.erase(my_cnt.end() - 200, my_cnt.end() - 3);
+    stl_cnt.erase(stl_cnt.end() - 200, stl_cnt.end() - 3);
+    my_cnt.insert(my_cnt.begin() + 7, 20, "x");
+    stl_cnt.insert(stl_cnt.begin() + 7, 20, "x");
+
+    REQUIRE( my_cnt.size() == stl_cnt.size() );
+    REQUIRE( std::equal(stl_cnt.begin(), stl_cnt.end(), my_cnt.begin()) );
+    for (size_t i = 0; i < stl_cnt.size(); i += 7)
+        REQUIRE( my_cnt[i] == stl_cnt[i] );
+    REQUIRE( std::equal(stl_cnt.rbegin(), stl_cnt.rend(), my_cnt.rbegin()) );
+
+    TestType copy (my_cnt);
+    REQUIRE( copy == my_cnt );
+    my_cnt.clear();
+    REQUIRE( my_cnt.empty() );
+    my_cnt.push_back("again");
+    REQUIRE( my_cnt.front() == "again" );
+}
+#endif
+
+#ifndef VERIFY_UNIT_TESTS
+// counts the chunks an ft::deque holds, the map is allocated as int*
+static long live_chunks = 0;
+
+template <class T>
+struct chunk_counter : public std::allocator<T>
+{
+    template <class U>
+    struct rebind
+    {
+        typedef chunk_counter<U> other;
+    };
+
+    chunk_counter (void) {}
+    template <class U>
+    chunk_counter (const chunk_counter<U>&) {}
+
+    T* allocate (size_t n, const void* = 0)
+    {
+        live_chunks += sizeof(T) == sizeof(int);
+        return std::allocator<T>::allocate(n);
+    }
+
+    void deallocate (T* p, size_t n)
+    {
+        live_chunks -= sizeof(T) == sizeof(int);
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+TEST_CASE("deque allocates its chunks lazily & reuses them", "[deque][capacity]")
+{
+    typedef ft::deque<int, chunk_counter<int>, ft::chunk_elements<4> > deque_type;
+
+    live_chunks = 0;
+    SECTION("an empty deque holds no memory") {
+        {
+            deque_type dq;
+            CHECK( live_chunks == 0 );
+            CHECK( dq.begin() == dq.end() );
+            CHECK( dq.rbegin() == dq.rend() );
+            dq.clear();
+            dq.erase(dq.begin(), dq.end());
+            deque_type copy (dq);
+            CHECK( copy.empty() );
+            CHECK( live_chunks == 0 );
+            dq.push_back(1);
+            CHECK( live_chunks == 1 );
+            CHECK( dq.front() == 1 );
+        }
+        CHECK( live_chunks == 0 );
+    }
+    SECTION("a fifo recycles the chunks it drains") {
+        deque_type dq;
+        for (int i = 0; i < 10; ++i)
+            dq.push_back(i);
+        long held = live_chunks;
+        for (int i = 10; i < 10000; ++i) {
+            dq.push_back(i);
+            dq.pop_front();
+            REQUIRE( live_chunks <= held + 2 );
+            REQUIRE( dq.front() == i - 9 );
+        }
+        CHECK( dq.size() == 10 );
+    }
+    SECTION("drained chunks are bounded") {
+        deque_type dq;
+        for (int i = 0; i < 1000; ++i)
+            dq.push_front(i);
+        while (dq.size() > 1)
+            dq.pop_back();
+        CHECK( live_chunks <= 4 );
+        CHECK( dq.front() == 999 );
+        for (int i = 0; i < 100; ++i)
+            dq.push_back(i);
+        dq.erase(dq.begin() + 1, dq.end() - 1);
+        CHECK( live_chunks <= 4 );
+        CHECK( dq.size() == 2 );
+        CHECK( dq.back() == 99 );
+    }
+    SECTION("shrink_to_fit releases the unused chunks & map slots") {
+        deque_type dq;
+        for (int i = 0; i < 100; ++i)
+            dq.push_back(i);
+        for (int i = 0; i < 90; ++i)
+            dq.pop_front();
+        dq.shrink_to_fit();
+        CHECK( live_chunks <= 4 );
+        for (int i = 0; i < 10; ++i)
+            REQUIRE( dq[i] == 90 + i );
+        dq.push_front(-1);
+        dq.push_back(100);
+        CHECK( dq.front() == -1 );
+        CHECK( dq.back() == 100 );
+        dq.clear();
+        dq.shrink_to_fit();
+        CHECK( live_chunks == 0 );
+        dq.push_front(7);
+        CHECK( dq.back() == 7 );
+    }
+    CHECK( live_chunks == 0 );
+}
+#endif
+
+#ifndef VERIFY_UNIT_TESTS
+struct summer
+{
+    long sum;
+
+    summer (void) : sum(0) {}
+    void operator() (int x) { sum += x; }
+};
+
+TEST_CASE("segmented algorithms walk deques chunk by chunk", "[deque][algorithms]")
+{
+    typedef ft::deque<int, std::allocator<int>, ft::chunk_elements<7> > deque_type;
+
+    deque_type my_cnt;
+    std::deque<int> stl_cnt;
+    for (int i = 0; i < 100; ++i) {
+        my_cnt.push_back(i);
+        stl_cnt.push_back(i);
+        my_cnt.push_front(-i);
+        stl_cnt.push_front(-i);
+    }
+    size_t first = GENERATE(0, 3, 7, 50, 199);
+    size_t last = GENERATE(0, 6, 14, 120, 200);
+    if (last < first)
+        std::swap(first, last);
+    deque_type::iterator my_first = my_cnt.begin() + first, my_last = my_cnt.begin() + last;
+    std::deque<int>::iterator stl_first = stl_cnt.begin() + first, stl_last = stl_cnt.begin() + last;
+
+    SECTION("for_each") {
+        summer my_sum = ft::for_each(my_first, my_last, summer());
+        summer stl_sum = std::for_each(stl_first, stl_last, summer());
+        CHECK( my_sum.sum == stl_sum.sum );
+    }
+    SECTION("fill") {
+        ft::fill(my_first, my_last, 42);
+        std::fill(stl_first, stl_last, 42);
+        CHECK( std::equal(stl_cnt.begin(), stl_cnt.end(), my_cnt.begin()) );
+    }
+    SECTION("find") {
+        int val = GENERATE(-99, -40, 0, 13, 99, 1000);
+        CHECK( ft::find(my_first, my_last, val) - my_cnt.begin() == std::find(stl_first, stl_last, val) - stl_cnt.begin() );
+    }
+    SECTION("copy between deques, vectors & lists") {
+        deque_type my_dst (250, 0);
+        std::deque<int> stl_dst (250, 0);
+        size_t offset = GENERATE(0, 5, 49);
+        CHECK( ft::copy(my_first, my_last, my_dst.begin() + offset) - my_dst.begin() == long(offset + last - first) );
+        std::copy(stl_first, stl_last, stl_dst.begin() + offset);
+        CHECK( std::equal(stl_dst.begin(), stl_dst.end(), my_dst.begin()) );
+
+        std::vector<int> vec (stl_first, stl_last);
+        ft::copy(vec.begin(), vec.end(), my_dst.begin() + 1);
+        std::copy(vec.begin(), vec.end(), stl_dst.begin() + 1);
+        CHECK( std::equal(stl_dst.begin(), stl_dst.end(), my_dst.begin()) );
+        if (!vec.empty()) {
+            ft::copy(&vec[0], &vec[0] + vec.size(), my_dst.begin() + 2);
+            std::copy(vec.begin(), vec.end(), stl_dst.begin() + 2);
+            CHECK( std::equal(stl_dst.begin(), stl_dst.end(), my_dst.begin()) );
+        }
+
+        std::list<int> lst (last - first);
+        ft::copy(my_first, my_last, lst.begin());
+        CHECK( std::equal(lst.begin(), lst.end(), stl_first) );
+    }
+    SECTION("equal & lexicographical_compare") {
+        deque_type other;
+        size_t shift = GENERATE(0, 1, 4);
+        for (size_t i = 0; i < shift; ++i)
+            other.push_back(0);
+        other.insert(other.end(), my_first, my_last);
+        deque_type::iterator other_first = other.begin() + shift;
+        CHECK( ft::equal(my_first, my_last, other_first) );
+        CHECK_FALSE( ft::lexicographical_compare(my_first, my_last, other_first, other.end()) );
+        if (first != last) {
+            *(other.end() - 1) += 1;
+            CHECK_FALSE( ft::equal(my_first, my_last, other_first) );
+            CHECK( ft::lexicographical_compare(my_first, my_last, other_first, other.end()) );
+            CHECK_FALSE( ft::lexicographical_compare(other_first, other.end(), my_first, my_last) );
+            CHECK( ft::lexicographical_compare(my_first, my_last - 1, my_first, my_last) );
+        }
+    }
+}
+#endif
+
+#ifndef VERIFY_UNIT_TESTS
+TEMPLATE_TEST_CASE("deque indexing matches its iterators", "[deque][element access]",
+                   (ft::deque<int, std::allocator<int>, ft::chunk_elements<5> >),
+                   (ft::deque<int, std::allocator<int>, ft::chunk_elements<8> >),
+                   (ft::deque<int, std::allocator<int>, ft::chunk_bytes<> >))
+{
+    TestType dq;
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            dq.push_back(i);
+            dq.push_front(-i);
+        }
+        for (int i = 0; i < 777; ++i)
+            dq.pop_front();
+        const TestType& cdq = dq;
+        typename TestType::const_iterator it = cdq.begin();
+        for (size_t i = 0; i < dq.size(); ++i, ++it) {
+            REQUIRE( &dq[i] == &*it );
+            REQUIRE( &cdq[i] == &*it );
+            REQUIRE( &dq.at(i) == &cdq.at(i) );
+        }
+        REQUIRE( &dq.front() == &*cdq.begin() );
+        REQUIRE( &dq.back() == &*(cdq.end() - 1) );
+        REQUIRE( &cdq.back() == &dq.back() );
+    }
+}
+#endif
+
+#ifndef VERIFY_UNIT_TESTS
+TEMPLATE_TEST_CASE("append, prepend & push_back_n build whole chunks", "[deque][modifiers]", int, std::string)
+{
+    typedef ft::deque<TestType, std::allocator<TestType>, ft::chunk_elements<16> > deque_type;
+
+    deque_type my_cnt;
+    std::deque<TestType> stl_cnt;
+    size_t before = GENERATE(0, 1, 15, 40);
+    for (size_t i = 0; i < before; ++i) {
+        my_cnt.push_back(make_value<TestType>(i));
+        stl_cnt.push_back(make_value<TestType>(i));
+    }
+    size_t n = GENERATE(0, 1, 16, 17, 100);
+    ft::vector<TestType> vec;
+    for (size_t i = 0; i < n; ++i)
+        vec.push_back(make_value<TestType>(1000 + i));
+
+    SECTION("from ft::vector iterators") {
+        my_cnt.append(vec.begin(), vec.end());
+        my_cnt.prepend(vec.begin(), vec.end());
+        stl_cnt.insert(stl_cnt.end(), vec.begin(), vec.end());
+        stl_cnt.insert(stl_cnt.begin(), vec.begin(), vec.end());
+    }
+    SECTION("from pointers") {
+        if (n > 0) {
+            const TestType* first = &vec[0];
+            my_cnt.append(first, first + n);
+            my_cnt.prepend(&vec[0], &vec[0] + n);
+            stl_cnt.insert(stl_cnt.end(), vec.begin(), vec.end());
+            stl_cnt.insert(stl_cnt.begin(), vec.begin(), vec.end());
+        }
+    }
+    SECTION("from list iterators") {
+        std::list<TestType> lst (vec.begin(), vec.end());
+        my_cnt.prepend(lst.begin(), lst.end());
+        my_cnt.append(lst.rbegin(), lst.rend());
+        stl_cnt.insert(stl_cnt.begin(), lst.begin(), lst.end());
+        stl_cnt.insert(stl_cnt.end(), lst.rbegin(), lst.rend());
+    }
+    SECTION("from input iterators") {
+        std::stringstream ss;
+        for (size_t i = 0; i < n; ++i)
+            ss << make_value<TestType>(1000 + i) << ' ';
+        std::stringstream ss2 (ss.str());
+        my_cnt.prepend(std::istream_iterator<TestType>(ss), std::istream_iterator<TestType>());
+        my_cnt.append(std::istream_iterator<TestType>(ss2), std::istream_iterator<TestType>());
+        stl_cnt.insert(stl_cnt.begin(), vec.begin(), vec.end());
+        stl_cnt.insert(stl_cnt.end(), vec.begin(), vec.end());
+    }
+    SECTION("push_back_n") {
+        my_cnt.push_back_n(n, make_value<TestType>(-3));
+        stl_cnt.insert(stl_cnt.end(), n, make_value<TestType>(-3));
+        if (!stl_cnt.empty()) {
+            my_cnt.push_back_n(n, my_cnt.front());
+            stl_cnt.insert(stl_cnt.end(), n, stl_cnt.front());
+        }
+    }
+    REQUIRE( my_cnt.size() == stl_cnt.size() );
+    REQUIRE( std::equal(stl_cnt.begin(), stl_cnt.end(), my_cnt.begin()) );
+    REQUIRE( std::equal(stl_cnt.rbegin(), stl_cnt.rend(), my_cnt.rbegin()) );
+    my_cnt.push_front(make_value<TestType>(7));
+    my_cnt.push_back(make_value<TestType>(8));
+    REQUIRE( my_cnt.size() == stl_cnt.size() + 2 );
+}
+#endif
+
+// trivially copyable, but can't be assigned
+struct frozen_int
+{
+    const int x;
+
+    frozen_int (int i) : x(i) {}
+};
+
+TEST_CASE("deque fills chunks with elements which can't be assigned", "[deque][modifiers]")
+{
+    LIB::deque<frozen_int> cnt (1500, frozen_int(7));
+    cnt.push_back(frozen_int(9));
+    REQUIRE( cnt.size() == 1501 );
+    REQUIRE( cnt[0].x == 7 );
+    REQUIRE( cnt[1499].x == 7 );
+    REQUIRE( cnt.back().x == 9 );
+#ifndef VERIFY_UNIT_TESTS
+    cnt.push_back_n(700, frozen_int(8));
+    REQUIRE( cnt.size() == 2201 );
+    REQUIRE( cnt[1501].x == 8 );
+    REQUIRE( cnt.back().x == 8 );
+#endif
+}
@@ -0,0 +1,236 @@
+#include "../srcs/intrusive_avl_set/intrusive_avl_set.hpp"
+#include "../srcs/intrusive_list/intrusive_list.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+// ft::intrusive_avl_set has no stl counterpart, it is checked against a
+// std::set of the keys it should link
+#ifndef VERIFY_UNIT_TESTS
+
+struct record
+{
+    int key;
+    int value;
+    ft::avl_set_hook by_key;
+    ft::avl_set_hook by_value;
+    ft::list_hook lru;
+
+    record (int k = 0, int v = 0) : key(k), value(v) {}
+};
+
+struct key_less
+{
+    bool operator() (const record& a, const record& b) const { return a.key < b.key; }
+};
+
+struct value_less
+{
+    bool operator() (const record& a, const record& b) const { return a.value < b.value || (a.value == b.value && a.key < b.key); }
+};
+
+typedef ft::intrusive_avl_set<record, &record::by_key, key_less> key_set;
+typedef ft::intrusive_avl_set<record, &record::by_value, value_less> value_set;
+typedef ft::intrusive_list<record, &record::lru> lru_list;
+
+static bool same (const key_set& s, const std::set<int>& ref)
+{
+    if (s.size() != ref.size())
+        return false;
+    std::set<int>::const_iterator rit = ref.begin();
+    for (key_set::const_iterator it = s.begin(); it != s.end(); ++it, ++rit) {
+        if (it->key != *rit)
+            return false;
+    }
+    std::set<int>::const_reverse_iterator rrit = ref.rbegin();
+    for (key_set::const_reverse_iterator it = s.rbegin(); it != s.rend(); ++it, ++rrit) {
+        if (it->key != *rrit)
+            return false;
+    }
+    return true;
+}
+
+// checks the heights, sizes & balance of every subtree below node
+static int check_subtree (const ft::avl_node_base* node, size_t& size)
+{
+    if (!node) {
+        size = 0;
+        return -1;
+    }
+    size_t lsize, rsize;
+    int lheight = check_subtree(node->left, lsize);
+    int rheight = check_subtree(node->right, rsize);
+    REQUIRE( (!node->left || node->left->parent == node) );
+    REQUIRE( (!node->right || node->right->parent == node) );
+    REQUIRE( std::abs(lheight - rheight) <= 1 );
+    REQUIRE( node->height == std::max(lheight, rheight) + 1 );
+    size = lsize + rsize + 1;
+    REQUIRE( node->size == size );
+    return node->height;
+}
+
+// the root hangs as the left child of the header which is end()
+template <class Set>
+static void check_balance (Set& s)
+{
+    size_t size;
+    check_subtree(s.end().get_node()->left, size);
+    REQUIRE( size == s.size() );
+}
+
+TEST_CASE("intrusive_avl_set links elements in order", "[intrusive_avl_set][basics]")
+{
+    std::vector<record> records;
+    // 263 is prime to 500, the keys come scrambled
+    for (int i = 0; i < 500; ++i)
+        records.push_back(record(i * 263 % 500, i % 7));
+
+    key_set s;
+    REQUIRE( s.empty() );
+    REQUIRE( s.begin() == s.end() );
+    REQUIRE( s.rbegin() == s.rend() );
+
+    std::set<int> ref;
+    for (size_t i = 0; i < records.size(); ++i) {
+        std::pair<key_set::iterator, bool> ret = s.insert(records[i]);
+        REQUIRE( ret.second );
+        REQUIRE( &*ret.first == &records[i] );
+        ref.insert(records[i].key);
+    }
+    REQUIRE( same(s, ref) );
+    check_balance(s);
+
+    // an element with the same key is not linked
+    record twin (records[0].key);
+    std::pair<key_set::iterator, bool> ret = s.insert(twin);
+    REQUIRE( !ret.second );
+    REQUIRE( &*ret.first == &records[0] );
+    REQUIRE( !twin.by_key.is_linked() );
+
+    REQUIRE( s.count(record(250)) == 1 );
+    REQUIRE( s.count(record(500)) == 0 );
+    REQUIRE( s.find(record(250))->key == 250 );
+    REQUIRE( s.find(record(-1)) == s.end() );
+    REQUIRE( s.lower_bound(record(100))->key == 100 );
+    REQUIRE( s.upper_bound(record(100))->key == 101 );
+    REQUIRE( s.lower_bound(record(1000)) == s.end() );
+
+    // the part which is not compared can be modified in place
+    s.find(record(10))->value = 99;
+    for (size_t i = 0; i < records.size(); ++i) {
+        if (records[i].key == 10)
+            REQUIRE( records[i].value == 99 );
+    }
+
+    s.clear();
+    REQUIRE( s.empty() );
+    for (size_t i = 0; i < records.size(); ++i)
+        REQUIRE( !records[i].by_key.is_linked() );
+}
+
+TEST_CASE("intrusive_avl_set unlinks from anywhere", "[intrusive_avl_set][modifiers]")
+{
+    std::vector<record> records;
+    for (int i = 0; i < 300; ++i)
+        records.push_back(record(i));
+    key_set s (records.begin(), records.end());
+    std::set<int> ref;
+    for (int i = 0; i < 300; ++i)
+        ref.insert(i);
+    REQUIRE( same(s, ref) );
+    check_balance(s);
+
+    std::srand(42);
+    for (int i = 0; i < 600; ++i) {
+        record& r = records[std::rand() % records.size()];
+        if (r.by_key.is_linked()) {
+            REQUIRE( &*s.iterator_to(r) == &r );
+            s.unlink(r);
+            ref.erase(r.key);
+            REQUIRE( !r.by_key.is_linked() );
+        } else {
+            REQUIRE( s.insert(r).second );
+            ref.insert(r.key);
+        }
+        check_balance(s);
+    }
+    REQUIRE( same(s, ref) );
+
+    REQUIRE( s.erase(record(*ref.begin())) == 1 );
+    REQUIRE( s.erase(record(-1)) == 0 );
+    ref.erase(ref.begin());
+    key_set::iterator first = s.begin();
+    key_set::iterator last = first;
+    std::advance(last, 20);
+    s.erase(first, last);
+    std::set<int>::iterator rlast = ref.begin();
+    std::advance(rlast, 20);
+    ref.erase(ref.begin(), rlast);
+    REQUIRE( same(s, ref) );
+    check_balance(s);
+
+    key_set other;
+    s.swap(other);
+    REQUIRE( s.empty() );
+    REQUIRE( same(other, ref) );
+    ft::swap(s, other);
+    REQUIRE( same(s, ref) );
+    check_balance(s);
+
+    key_set moved (std::move(s));
+    REQUIRE( s.empty() );
+    REQUIRE( same(moved, ref) );
+}
+
+TEST_CASE("intrusive containers share their elements", "[intrusive_avl_set][hooks]")
+{
+    // a tiny lru cache: records are found by key, ranked by value &
+    // evicted from the back of the lru list, all without allocating
+    std::vector<record> records;
+    for (int i = 0; i < 64; ++i)
+        records.push_back(record(i, (i * 37) % 64));
+
+    key_set index;
+    value_set ranking;
+    lru_list lru;
+    const size_t capacity = 16;
+
+    std::srand(7);
+    for (int i = 0; i < 2000; ++i) {
+        record& r = records[std::rand() % records.size()];
+        if (r.lru.is_linked()) {
+            // a hit moves the record to the front
+            lru.splice(lru.begin(), lru, lru.iterator_to(r));
+        } else {
+            if (lru.size() == capacity) {
+                record& victim = lru.back();
+                lru.pop_back();
+                index.unlink(victim);
+                ranking.unlink(victim);
+            }
+            lru.push_front(r);
+            index.insert(r);
+            ranking.insert(r);
+        }
+        REQUIRE( &lru.front() == &r );
+        REQUIRE( index.size() == lru.size() );
+        REQUIRE( ranking.size() == lru.size() );
+    }
+    check_balance(index);
+    check_balance(ranking);
+
+    for (lru_list::iterator it = lru.begin(); it != lru.end(); ++it) {
+        REQUIRE( &*index.find(*it) == &*it );
+        REQUIRE( &*ranking.find(*it) == &*it );
+    }
+    REQUIRE( std::is_sorted(index.begin(), index.end(), key_less()) );
+    REQUIRE( std::is_sorted(ranking.begin(), ranking.end(), value_less()) );
+    for (size_t i = 0; i < records.size(); ++i) {
+        REQUIRE( records[i].by_key.is_linked() == records[i].lru.is_linked() );
+        REQUIRE( records[i].by_value.is_linked() == records[i].lru.is_linked() );
+    }
+}
+
+#endif
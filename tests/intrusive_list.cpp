@@ -0,0 +1,231 @@
+#include "../srcs/intrusive_list/intrusive_list.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <list>
+#include <vector>
+
+// ft::intrusive_list has no stl counterpart, it is checked against a
+// std::list of the ids it should link
+#ifndef VERIFY_UNIT_TESTS
+
+struct entry
+{
+    int id;
+    ft::list_hook hook;
+    ft::list_hook other_hook;
+
+    entry (int i = 0) : id(i) {}
+};
+
+typedef ft::intrusive_list<entry, &entry::hook> entry_list;
+typedef ft::intrusive_list<entry, &entry::other_hook> other_list;
+
+template <class IntrusiveList>
+static bool same (const IntrusiveList& l, const std::list<int>& ref)
+{
+    if (l.size() != ref.size())
+        return false;
+    std::list<int>::const_iterator rit = ref.begin();
+    for (typename IntrusiveList::const_iterator it = l.begin(); it != l.end(); ++it, ++rit) {
+        if (it->id != *rit)
+            return false;
+    }
+    std::list<int>::const_reverse_iterator rrit = ref.rbegin();
+    for (typename IntrusiveList::const_reverse_iterator it = l.rbegin(); it != l.rend(); ++it, ++rrit) {
+        if (it->id != *rrit)
+            return false;
+    }
+    return true;
+}
+
+TEST_CASE("intrusive_list links elements in place", "[intrusive_list][basics]")
+{
+    std::vector<entry> entries;
+    for (int i = 0; i < 10; ++i)
+        entries.push_back(entry(i));
+
+    entry_list l;
+    REQUIRE( l.empty() );
+    REQUIRE( l.begin() == l.end() );
+    REQUIRE( l.rbegin() == l.rend() );
+    REQUIRE( !entries[0].hook.is_linked() );
+
+    std::list<int> ref;
+    for (int i = 0; i < 5; ++i) {
+        l.push_back(entries[i]);
+        ref.push_back(i);
+        l.push_front(entries[9 - i]);
+        ref.push_front(9 - i);
+    }
+    REQUIRE( same(l, ref) );
+    REQUIRE( &l.front() == &entries[5] );
+    REQUIRE( &l.back() == &entries[4] );
+    REQUIRE( entries[3].hook.is_linked() );
+    REQUIRE( !entries[3].other_hook.is_linked() );
+
+    // the elements themselves are reached, not copies
+    l.front().id = 42;
+    REQUIRE( entries[5].id == 42 );
+    entries[5].id = 5;
+
+    l.pop_front();
+    ref.pop_front();
+    l.pop_back();
+    ref.pop_back();
+    REQUIRE( same(l, ref) );
+    REQUIRE( !entries[5].hook.is_linked() );
+    REQUIRE( !entries[4].hook.is_linked() );
+
+    l.clear();
+    REQUIRE( l.empty() );
+    for (size_t i = 0; i < entries.size(); ++i)
+        REQUIRE( !entries[i].hook.is_linked() );
+}
+
+TEST_CASE("intrusive_list unlinks from anywhere", "[intrusive_list][modifiers]")
+{
+    std::vector<entry> entries;
+    for (int i = 0; i < 100; ++i)
+        entries.push_back(entry(i));
+    entry_list l (entries.begin(), entries.end());
+    std::list<int> ref;
+    for (int i = 0; i < 100; ++i)
+        ref.push_back(i);
+    REQUIRE( same(l, ref) );
+
+    std::srand(42);
+    for (int i = 0; i < 60; ++i) {
+        int id = std::rand() % 100;
+        if (entries[id].hook.is_linked()) {
+            l.unlink(entries[id]);
+            ref.remove(id);
+        } else {
+            entry_list::iterator pos = l.begin();
+            std::advance(pos, l.size() / 2);
+            std::list<int>::iterator rpos = ref.begin();
+            std::advance(rpos, ref.size() / 2);
+            REQUIRE( &*l.insert(pos, entries[id]) == &entries[id] );
+            ref.insert(rpos, id);
+        }
+        REQUIRE( same(l, ref) );
+    }
+
+    entry_list::iterator it = l.iterator_to(entries[ref.front()]);
+    REQUIRE( it == l.begin() );
+    it = l.erase(it);
+    ref.pop_front();
+    REQUIRE( it == l.begin() );
+    REQUIRE( same(l, ref) );
+
+    entry_list::iterator last = l.begin();
+    std::advance(last, 10);
+    REQUIRE( l.erase(l.begin(), last) == last );
+    ref.erase(ref.begin(), std::next(ref.begin(), 10));
+    REQUIRE( same(l, ref) );
+
+    l.remove_if([](const entry& e) { return e.id % 3 == 0; });
+    ref.remove_if([](int id) { return id % 3 == 0; });
+    REQUIRE( same(l, ref) );
+    for (size_t i = 0; i < entries.size(); ++i)
+        REQUIRE( entries[i].hook.is_linked() == (std::find(ref.begin(), ref.end(), entries[i].id) != ref.end()) );
+}
+
+TEST_CASE("intrusive_list holds an element in several lists", "[intrusive_list][hooks]")
+{
+    std::vector<entry> entries;
+    for (int i = 0; i < 10; ++i)
+        entries.push_back(entry(i));
+
+    entry_list all (entries.begin(), entries.end());
+    other_list odd;
+    for (size_t i = 1; i < entries.size(); i += 2)
+        odd.push_front(entries[i]);
+    REQUIRE( same(odd, std::list<int>{9, 7, 5, 3, 1}) );
+
+    all.unlink(entries[5]);
+    REQUIRE( same(all, std::list<int>{0, 1, 2, 3, 4, 6, 7, 8, 9}) );
+    REQUIRE( same(odd, std::list<int>{9, 7, 5, 3, 1}) );
+    odd.unlink(entries[3]);
+    REQUIRE( same(all, std::list<int>{0, 1, 2, 3, 4, 6, 7, 8, 9}) );
+    REQUIRE( same(odd, std::list<int>{9, 7, 5, 1}) );
+
+    // a copy is not linked & an assignment keeps the links
+    entry copy = entries[7];
+    REQUIRE( !copy.hook.is_linked() );
+    REQUIRE( !copy.other_hook.is_linked() );
+    entries[7] = entry(70);
+    REQUIRE( same(all, std::list<int>{0, 1, 2, 3, 4, 6, 70, 8, 9}) );
+    REQUIRE( same(odd, std::list<int>{9, 70, 5, 1}) );
+}
+
+TEST_CASE("intrusive_list splices & reverses", "[intrusive_list][operations]")
+{
+    std::vector<entry> entries;
+    for (int i = 0; i < 20; ++i)
+        entries.push_back(entry(i));
+
+    entry_list a (entries.begin(), entries.begin() + 10);
+    entry_list b (entries.begin() + 10, entries.end());
+    std::list<int> ra {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::list<int> rb {10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+
+    // an lru cache moves the element it touches to the front
+    a.splice(a.begin(), a, a.iterator_to(entries[6]));
+    ra.splice(ra.begin(), ra, std::next(ra.begin(), 6));
+    REQUIRE( same(a, ra) );
+
+    a.splice(a.end(), b, b.iterator_to(entries[12]), b.iterator_to(entries[15]));
+    ra.splice(ra.end(), rb, std::next(rb.begin(), 2), std::next(rb.begin(), 5));
+    REQUIRE( same(a, ra) );
+    REQUIRE( same(b, rb) );
+
+    a.splice(a.iterator_to(entries[3]), b);
+    ra.splice(std::next(ra.begin(), 4), rb);
+    REQUIRE( same(a, ra) );
+    REQUIRE( b.empty() );
+
+    a.reverse();
+    ra.reverse();
+    REQUIRE( same(a, ra) );
+
+    a.swap(b);
+    REQUIRE( a.empty() );
+    REQUIRE( same(b, ra) );
+    ft::swap(a, b);
+    REQUIRE( same(a, ra) );
+
+    entry_list moved (std::move(a));
+    REQUIRE( a.empty() );
+    REQUIRE( same(moved, ra) );
+}
+
+TEST_CASE("intrusive_list leaves its elements unlinked when destroyed", "[intrusive_list][basics]")
+{
+    std::vector<entry> entries (5);
+    {
+        entry_list l (entries.begin(), entries.end());
+        REQUIRE( l.size() == 5 );
+    }
+    for (size_t i = 0; i < entries.size(); ++i)
+        REQUIRE( !entries[i].hook.is_linked() );
+    entry_list l (entries.begin(), entries.end());
+    REQUIRE( l.size() == 5 );
+    l.clear();
+}
+
+TEST_CASE("member_hook finds the element from any of its hooks", "[intrusive_list][hooks]")
+{
+    typedef ft::member_hook<entry, ft::list_hook, &entry::hook> first_traits;
+    typedef ft::member_hook<entry, ft::list_hook, &entry::other_hook> other_traits;
+
+    entry entries[3];
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE( first_traits::to_value(first_traits::to_hook(entries[i])) == &entries[i] );
+        REQUIRE( other_traits::to_value(other_traits::to_hook(entries[i])) == &entries[i] );
+    }
+    REQUIRE( first_traits::offset() == reinterpret_cast<char*>(&entries[0].hook) - reinterpret_cast<char*>(&entries[0]) );
+    REQUIRE( other_traits::offset() == reinterpret_cast<char*>(&entries[0].other_hook) - reinterpret_cast<char*>(&entries[0]) );
+}
+
+#endif
@@ -1,7 +1,11 @@
 #include "../srcs/list/list.hpp"
 #include "catch.hpp"
 #include <list>
+#include <algorithm>
+#include <cstdlib>
 #include <vector>
+#include <memory>
+#include <stdexcept>
 
 #ifdef VERIFY_UNIT_TESTS
 # define LIB std
@@ -599,6 +603,29 @@ TEST_CASE("splice list", "[list][operations]")
         REQUIRE( l0.size() == 3 );
         CHECK( l1.size() == 5 );
     }
+    SECTION("ranges can be spliced within the same list") {
+        int moved[] = { 4, 5, 0, 1, 2, 3, 6, 7 };
+        it = l0.begin();
+        std::advance(it, 4);
+        LIB::list<int>::iterator last = it;
+        std::advance(last, 2);
+        l0.splice(l0.begin(), l0, it, last);
+        REQUIRE( l0.size() == 8 );
+        REQUIRE( std::equal(l0.begin(), l0.end(), moved) );
+        REQUIRE( std::equal(l0.rbegin(), l0.rend(), LIB::list<int>(moved, moved + 8).rbegin()) );
+
+        l0.splice(l0.end(), l0, l0.begin());
+        REQUIRE( l0.back() == 4 );
+        REQUIRE( l0.front() == 5 );
+
+        // an element spliced before itself or its successor stays put
+        l0.splice(l0.begin(), l0, l0.begin());
+        l0.splice(++l0.begin(), l0, l0.begin());
+        REQUIRE( l0.size() == 8 );
+        REQUIRE( l0.front() == 5 );
+        REQUIRE( l0.back() == 4 );
+        REQUIRE( std::distance(l0.rbegin(), l0.rend()) == 8 );
+    }
 }
 
 TEST_CASE("remove list", "[list][operations]")
@@ -732,6 +759,24 @@ TEST_CASE("merge list", "[list][operations]")
         l2.merge(l3);
         REQUIRE( l2.empty() );
         REQUIRE( l3.empty() );
+
+        l1.merge(l1);
+        REQUIRE( l1.size() == 5 );
+    }
+    SECTION("merging keeps the elements of *this ahead of their equals") {
+        typedef std::pair<int, char> elem;
+        elem a[] = { elem(1, 'a'), elem(3, 'a'), elem(3, 'a'), elem(8, 'a') };
+        elem b[] = { elem(0, 'b'), elem(1, 'b'), elem(2, 'b'), elem(2, 'b'), elem(3, 'b'), elem(9, 'b') };
+        elem c[] = { elem(0, 'b'), elem(1, 'a'), elem(1, 'b'), elem(2, 'b'), elem(2, 'b'), elem(3, 'a'),
+                     elem(3, 'a'), elem(3, 'b'), elem(8, 'a'), elem(9, 'b') };
+        LIB::list<elem> l0 (a, a + 4);
+        LIB::list<elem> l1 (b, b + 6);
+
+        l0.merge(l1, [](const elem& x, const elem& y) { return x.first < y.first; } );
+        REQUIRE( l1.empty() );
+        REQUIRE( l0.size() == 10 );
+        REQUIRE( std::equal(l0.begin(), l0.end(), c) );
+        REQUIRE( std::equal(l0.rbegin(), l0.rend(), LIB::list<elem>(c, c + 10).rbegin()) );
     }
 }
 
@@ -803,6 +848,63 @@ TEST_CASE("sort list", "[list][operations]")
         for (auto it = l5.begin(); it != l5.end(); ++it, ++i)
             REQUIRE( *it == arr1_sorted[i] );
     }
+    SECTION("sorting large lists gives the same order as std::list") {
+        for (int n = 0; n < 3000; n += 299) {
+            LIB::list<int> l;
+            std::list<int> ref;
+            for (int j = 0; j < n; ++j) {
+                int val = std::rand() % 1000 - 500;
+                l.push_back(val);
+                ref.push_back(val);
+            }
+            l.sort();
+            ref.sort();
+            REQUIRE( l.size() == ref.size() );
+            REQUIRE( std::equal(l.begin(), l.end(), ref.begin()) );
+            REQUIRE( std::equal(l.rbegin(), l.rend(), ref.rbegin()) );
+        }
+    }
+    SECTION("sorting is stable") {
+        // the keys repeat, the second members count up in insertion order
+        LIB::list< std::pair<int, int> > l;
+        for (int j = 0; j < 1000; ++j)
+            l.push_back(std::make_pair((j * 7919) % 13, j));
+        l.sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; } );
+
+        REQUIRE( l.size() == 1000 );
+        for (auto it = l.begin(), prev = it++; it != l.end(); prev = it++) {
+            REQUIRE( prev->first <= it->first );
+            if (prev->first == it->first)
+                REQUIRE( prev->second < it->second );
+        }
+    }
+    SECTION("a throwing comparator leaves a valid list") {
+        std::list<int> ref;
+        for (int j = 0; j < 100; ++j)
+            ref.push_back((j * 7919) % 101);
+        LIB::list<int> l (ref.begin(), ref.end());
+        int calls = 0;
+        int limit = GENERATE(0, 5, 50, 300);
+        REQUIRE_THROWS_AS( l.sort([&](int a, int b) {
+            if (calls++ == limit)
+                throw std::runtime_error("comp");
+            return a < b;
+        }), std::runtime_error );
+
+        REQUIRE( l.size() == 100 );
+        REQUIRE( std::distance(l.begin(), l.end()) == 100 );
+        REQUIRE( std::distance(l.rbegin(), l.rend()) == 100 );
+        std::vector<int> forward (l.begin(), l.end());
+        std::vector<int> backward (l.rbegin(), l.rend());
+        REQUIRE( std::equal(forward.begin(), forward.end(), backward.rbegin()) );
+        REQUIRE( std::is_permutation(forward.begin(), forward.end(), ref.begin()) );
+#ifndef VERIFY_UNIT_TESTS
+        REQUIRE( std::equal(l.begin(), l.end(), ref.begin()) );
+#endif
+        l.sort();
+        ref.sort();
+        REQUIRE( std::equal(l.begin(), l.end(), ref.begin()) );
+    }
 }
 
 TEST_CASE("reverse list", "[list][operations]")
@@ -833,4 +935,175 @@ TEST_CASE("reverse list", "[list][operations]")
     REQUIRE( l2.size() == 2 );
     REQUIRE( *l2.begin() == 2 );
     REQUIRE( *++l2.begin() == 4 );
+
+    // the backward links are reversed too
+    i = 0;
+    for (auto it = l1.rbegin(); it != l1.rend(); ++it, ++i)
+        REQUIRE( *it == arr[i] );
+    l1.push_front(7);
+    l1.push_back(8);
+    REQUIRE( l1.front() == 7 );
+    REQUIRE( *++l1.begin() == 312 );
+    REQUIRE( l1.back() == 8 );
+    REQUIRE( *++l1.rbegin() == 2 );
+}
+
+TEST_CASE("move & emplace list", "[list][modifiers]")
+{
+    SECTION("move construction & assignment keep the nodes") {
+        LIB::list<std::string> src (10, "forty two");
+        const std::string * first = &src.front();
+        LIB::list<std::string> dst (std::move(src));
+        REQUIRE( src.empty() );
+        REQUIRE( dst.size() == 10 );
+        REQUIRE( &dst.front() == first );
+
+        LIB::list<std::string> other (3, "x");
+        other = std::move(dst);
+        REQUIRE( other.size() == 10 );
+        REQUIRE( &other.front() == first );
+    }
+    SECTION("move only types can be pushed & emplaced") {
+        LIB::list<std::unique_ptr<int> > cnt;
+        cnt.emplace_back(new int(2));
+        cnt.emplace_front(new int(0));
+        LIB::list<std::unique_ptr<int> >::iterator it = cnt.emplace(++cnt.begin(), new int(1));
+        REQUIRE( **it == 1 );
+        cnt.push_back(std::unique_ptr<int>(new int(3)));
+        cnt.insert(cnt.end(), std::unique_ptr<int>(new int(4)));
+        int i = 0;
+        for (it = cnt.begin(); it != cnt.end(); ++it, ++i)
+            REQUIRE( **it == i );
+        REQUIRE( cnt.size() == 5 );
+    }
 }
+
+// no default constructor, the list never builds a value it was not given
+struct no_default
+{
+    explicit no_default (int v) : value(v) {}
+    int value;
+};
+
+TEST_CASE("list holds values which are not default constructible", "[list][basics]")
+{
+    LIB::list<no_default> cnt;
+    REQUIRE( cnt.begin() == cnt.end() );
+    REQUIRE( cnt.rbegin() == cnt.rend() );
+    for (int i = 0; i < 10; ++i)
+        cnt.push_back(no_default(i));
+    cnt.push_front(no_default(-1));
+    REQUIRE( cnt.front().value == -1 );
+    REQUIRE( cnt.back().value == 9 );
+    REQUIRE( (--cnt.end())->value == 9 );
+
+    LIB::list<no_default> copy (cnt);
+    REQUIRE( copy.size() == 11 );
+    copy.pop_front();
+    copy.pop_back();
+    REQUIRE( copy.front().value == 0 );
+    REQUIRE( copy.back().value == 8 );
+}
+
+TEST_CASE("list swap keeps iterators to the elements valid", "[list][modifiers]")
+{
+    LIB::list<int> lhs;
+    LIB::list<int> rhs;
+    for (int i = 0; i < 5; ++i)
+        lhs.push_back(i);
+    LIB::list<int>::iterator first = lhs.begin();
+    LIB::list<int>::iterator last = --lhs.end();
+
+    lhs.swap(rhs);
+    REQUIRE( lhs.empty() );
+    REQUIRE( lhs.begin() == lhs.end() );
+    REQUIRE( first == rhs.begin() );
+    REQUIRE( last == --rhs.end() );
+    REQUIRE( *rhs.rbegin() == 4 );
+    int expected = 4;
+    for (LIB::list<int>::reverse_iterator it = rhs.rbegin(); it != rhs.rend(); ++it)
+        REQUIRE( *it == expected-- );
+
+    // both lists are usable after a swap with an empty one
+    lhs.push_back(42);
+    rhs.swap(lhs);
+    REQUIRE( rhs.size() == 1 );
+    REQUIRE( rhs.front() == 42 );
+    REQUIRE( *first == 0 );
+    REQUIRE( lhs.size() == 5 );
+    lhs.erase(first);
+    REQUIRE( lhs.front() == 1 );
+}
+
+#ifndef VERIFY_UNIT_TESTS
+// counts the nodes allocated by an ft::list
+static long live_nodes = 0;
+
+template <class T>
+struct node_counter : public std::allocator<T>
+{
+    template <class U>
+    struct rebind
+    {
+        typedef node_counter<U> other;
+    };
+
+    node_counter (void) {}
+    template <class U>
+    node_counter (const node_counter<U>&) {}
+
+    T* allocate (size_t n, const void* = 0)
+    {
+        live_nodes += n;
+        return std::allocator<T>::allocate(n);
+    }
+
+    void deallocate (T* p, size_t n)
+    {
+        live_nodes -= n;
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+TEST_CASE("list only allocates the nodes of its elements", "[list][basics]")
+{
+    typedef ft::list<std::string, node_counter<std::string> > list_type;
+
+    live_nodes = 0;
+    {
+        list_type empty;
+        list_type moved (std::move(empty));
+        list_type copy (moved);
+        REQUIRE( live_nodes == 0 );
+        copy.push_back("x");
+        copy.push_back("y");
+        REQUIRE( live_nodes == 2 );
+        moved = std::move(copy);
+        REQUIRE( live_nodes == 2 );
+        moved.swap(empty);
+        REQUIRE( live_nodes == 2 );
+    }
+    REQUIRE( live_nodes == 0 );
+}
+
+TEST_CASE("list splice & erase take the known count of a range", "[list][operations]")
+{
+    int v[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    ft::list<int> l0 (v, v + 8);
+    ft::list<int> l1;
+
+    ft::list<int>::iterator last = l0.begin();
+    std::advance(last, 3);
+    l1.splice(l1.end(), l0, l0.begin(), last, 3);
+    REQUIRE( l0.size() == 5 );
+    REQUIRE( l1.size() == 3 );
+    REQUIRE( l1.back() == 2 );
+    REQUIRE( l0.front() == 3 );
+
+    last = l0.begin();
+    std::advance(last, 2);
+    REQUIRE( *l0.erase(l0.begin(), last, 2) == 5 );
+    REQUIRE( l0.size() == 3 );
+    REQUIRE( l0.front() == 5 );
+}
+#endif
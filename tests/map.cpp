@@ -4,6 +4,8 @@
 #include <array>
 #include <list>
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #ifdef VERIFY_UNIT_TESTS
 # define LIB std
@@ -75,6 +77,44 @@ TEST_CASE("maps can be assigned using the = operator", "[map][operators]")
     REQUIRE(( (--my_map1.end())->second != (--my_map2.end())->second ));
 }
 
+TEST_CASE("maps of different sizes can be assigned to each other", "[map][operators]")
+{
+    LIB::map<int, std::string> big;
+    LIB::map<int, std::string> small;
+    for (int i = 0; i < 500; ++i)
+        big[rand() % 1000] = std::to_string(i);
+    for (int i = 0; i < 20; ++i)
+        small[rand() % 1000] = std::to_string(-i);
+    LIB::map<int, std::string> big_copy (big);
+    LIB::map<int, std::string> small_copy (small);
+
+    // shrinking & growing the destination
+    big = small_copy;
+    small = big_copy;
+    REQUIRE( big.size() == small_copy.size() );
+    REQUIRE( small.size() == big_copy.size() );
+    REQUIRE( std::equal(big.begin(), big.end(), small_copy.begin()) );
+    REQUIRE( std::equal(small.rbegin(), small.rend(), big_copy.rbegin()) );
+
+    // self assignment & assignment from an empty map
+    small = small;
+    REQUIRE( small.size() == big_copy.size() );
+    big = LIB::map<int, std::string>();
+    REQUIRE( big.empty() );
+    REQUIRE(( big.begin() == big.end() ));
+
+    // copies are fully functional trees
+    for (int i = 0; i < 300; ++i) {
+        int key = rand() % 1000;
+        small.erase(key);
+        big_copy.erase(key);
+        small[key + 1] = "x";
+        big_copy[key + 1] = "x";
+    }
+    REQUIRE( small.size() == big_copy.size() );
+    REQUIRE( std::equal(small.begin(), small.end(), big_copy.begin()) );
+}
+
 TEST_CASE("maps contain no duplicates", "[map][basics]")
 {
     LIB::map<int, int> map;
@@ -496,6 +536,44 @@ TEST_CASE("lower_bound & upper_bound work as expected", "[map][operations]")
     }
 }
 
+// the comparator holds state, a default constructed one sorts ascending
+struct direction
+{
+    bool descending;
+
+    direction (bool desc = false) : descending(desc) {}
+    bool operator() (int a, int b) const { return descending ? b < a : a < b; }
+};
+
+static bool greater_int (int a, int b) { return a > b; }
+
+TEST_CASE("lookups use the comparator the map was built with", "[map][operations]")
+{
+    SECTION("comparator instance") {
+        LIB::map<int, int, direction> m ((direction(true)));
+        for (int i = 0; i < 10; ++i)
+            m[i] = i * 10;
+        REQUIRE( m.lower_bound(5)->first == 5 );
+        REQUIRE( m.upper_bound(5)->first == 4 );
+        REQUIRE( m.equal_range(5).first->first == 5 );
+        REQUIRE( m.equal_range(5).second->first == 4 );
+        REQUIRE( m.find(7)->second == 70 );
+        REQUIRE( m.count(7) == 1 );
+        REQUIRE( m.key_comp()(2, 1) );
+    }
+    SECTION("function pointer comparator") {
+        LIB::map<int, int, bool (*)(int, int)> m (greater_int);
+        for (int i = 0; i < 10; ++i)
+            m[i] = i * 10;
+        REQUIRE( m.lower_bound(5)->first == 5 );
+        REQUIRE( m.upper_bound(5)->first == 4 );
+        REQUIRE( m.equal_range(0).second == m.end() );
+        REQUIRE( m.find(3)->second == 30 );
+        REQUIRE( m.erase(3) == 1 );
+        REQUIRE( m.find(3) == m.end() );
+    }
+}
+
 TEST_CASE("equal_range works as expected", "[map][operations]")
 {
     LIB::map<char, int> mymap;
@@ -525,3 +603,234 @@ TEST_CASE("equal_range works as expected", "[map][operations]")
     REQUIRE(( cmymap.equal_range('u').first == cmymap.end() ));
     REQUIRE(( cmymap.equal_range('u').second == cmymap.end() ));
 }
+
+// order statistics are an ft extension
+#ifndef VERIFY_UNIT_TESTS
+TEST_CASE("rank, select & count_range work as expected", "[map][operations]")
+{
+    LIB::map<int, int> mymap;
+    std::map<int, int> stl_map;
+    for (int i = 0; i < 3000; ++i) {
+        int key = rand() % 2000;
+        mymap[key] = i;
+        stl_map[key] = i;
+    }
+    // erasing goes through the two child case & multiple rotations
+    for (int i = 0; i < 1000; ++i) {
+        int key = rand() % 2000;
+        mymap.erase(key);
+        stl_map.erase(key);
+    }
+    REQUIRE( mymap.size() == stl_map.size() );
+
+    size_t n = 0;
+    for (auto it = stl_map.begin(); it != stl_map.end(); ++it, ++n) {
+        REQUIRE( mymap.rank(it->first) == n );
+        REQUIRE( *mymap.select(n) == *it );
+    }
+    REQUIRE(( mymap.select(n) == mymap.end() ));
+    REQUIRE( mymap.rank(2001) == mymap.size() );
+
+    for (int i = 0; i < 200; ++i) {
+        int lo = rand() % 2100 - 50;
+        int hi = rand() % 2100 - 50;
+        REQUIRE( mymap.count_range(lo, hi) == (hi > lo ? (size_t)std::distance(stl_map.lower_bound(lo), stl_map.lower_bound(hi)) : 0) );
+        REQUIRE( ft::distance(mymap.lower_bound(lo), mymap.end()) == std::distance(stl_map.lower_bound(lo), stl_map.end()) );
+    }
+
+    const LIB::map<int, int>& cmymap = mymap;
+    REQUIRE( ft::distance(cmymap.begin(), cmymap.end()) == (long)cmymap.size() );
+    REQUIRE( ft::distance(cmymap.end(), cmymap.begin()) == -(long)cmymap.size() );
+
+    LIB::map<int, int> empty;
+    REQUIRE( ft::distance(empty.begin(), empty.end()) == 0 );
+    REQUIRE( empty.rank(42) == 0 );
+    REQUIRE(( empty.select(0) == empty.end() ));
+}
+#endif
+
+TEST_CASE("range construction handles sorted & unsorted input", "[map][basics]")
+{
+    std::vector<std::pair<int, int> > v;
+    for (int i = 0; i < 1000; ++i)
+        v.push_back(std::make_pair(i / 2, i)); // every key twice
+    for (int i = 0; i < 100; ++i)
+        v.push_back(std::make_pair(rand() % 1500, i)); // unsorted tail
+
+    std::map<int, int> stl_map (v.begin(), v.end());
+    LIB::map<int, int> my_map (v.begin(), v.end());
+    REQUIRE( my_map.size() == stl_map.size() );
+    REQUIRE( std::equal(stl_map.begin(), stl_map.end(), my_map.begin()) );
+
+    // the built tree keeps working w/ later modifications
+    for (int i = 0; i < 500; ++i) {
+        int key = rand() % 1500;
+        REQUIRE( my_map.erase(key) == stl_map.erase(key) );
+        my_map[key + 1] = i;
+        stl_map[key + 1] = i;
+    }
+    REQUIRE( my_map.size() == stl_map.size() );
+    REQUIRE( std::equal(stl_map.begin(), stl_map.end(), my_map.begin()) );
+    REQUIRE( std::equal(stl_map.rbegin(), stl_map.rend(), my_map.rbegin()) );
+}
+
+#ifndef VERIFY_UNIT_TESTS
+TEST_CASE("from_sorted builds a map from sorted input", "[map][basics]")
+{
+    std::map<int, int> stl_map;
+    for (int i = 0; i < 777; ++i)
+        stl_map[i * 3] = i;
+    LIB::map<int, int> my_map = LIB::map<int, int>::from_sorted(stl_map.begin(), stl_map.end());
+
+    REQUIRE( my_map.size() == stl_map.size() );
+    REQUIRE( std::equal(stl_map.begin(), stl_map.end(), my_map.begin()) );
+    REQUIRE( my_map.lower_bound(301)->first == 303 );
+    REQUIRE( my_map.select(100)->first == 300 );
+    REQUIRE( *(--my_map.end()) == *stl_map.rbegin() );
+
+    REQUIRE( LIB::map<int, int>::from_sorted(stl_map.end(), stl_map.end()).empty() );
+}
+#endif
+
+TEST_CASE("map moves & emplaces elements", "[map][modifiers]")
+{
+    SECTION("move construction & assignment leave the source empty") {
+        LIB::map<int, std::string> src;
+        for (int i = 0; i < 20; ++i)
+            src[i] = "forty two";
+        const std::string * first = &src.begin()->second;
+        LIB::map<int, std::string> dst (std::move(src));
+        REQUIRE( src.empty() );
+        REQUIRE( src.begin() == src.end() );
+        REQUIRE( dst.size() == 20 );
+        REQUIRE( &dst.begin()->second == first );
+
+        src[3] = "reused";
+        src = std::move(dst);
+        REQUIRE( src.size() == 20 );
+        REQUIRE( src[3] == "forty two" );
+    }
+    SECTION("emplace builds the pair in place & rejects duplicates") {
+        LIB::map<int, std::string> cnt;
+        std::map<int, std::string> stl_cnt;
+        for (int i = 0; i < 50; ++i) {
+            int k = (i * 7) % 31;
+            std::pair<LIB::map<int, std::string>::iterator, bool> ret = cnt.emplace(k, std::string(i, 'x'));
+            std::pair<std::map<int, std::string>::iterator, bool> stl_ret = stl_cnt.emplace(k, std::string(i, 'x'));
+            REQUIRE( ret.second == stl_ret.second );
+            REQUIRE( ret.first->second == stl_ret.first->second );
+        }
+        cnt.emplace_hint(cnt.end(), 100, "hint");
+        cnt.emplace_hint(cnt.begin(), -1, "hint");
+        cnt.emplace_hint(cnt.find(10), 10, "duplicate");
+        stl_cnt.emplace_hint(stl_cnt.end(), 100, "hint");
+        stl_cnt.emplace_hint(stl_cnt.begin(), -1, "hint");
+        stl_cnt.emplace_hint(stl_cnt.find(10), 10, "duplicate");
+        std::string moved ("moved");
+        cnt.insert(std::make_pair(200, std::move(moved)));
+        stl_cnt.insert(std::make_pair(200, std::string("moved")));
+        REQUIRE( cnt.size() == stl_cnt.size() );
+        REQUIRE( std::equal(cnt.begin(), cnt.end(), stl_cnt.begin()) );
+    }
+}
+
+// no default constructor, the map never builds a value it was not given
+struct no_default
+{
+    explicit no_default (int v) : value(v) {}
+    int value;
+};
+
+TEST_CASE("insertion orders the elements with the caller's comparator", "[map][modifiers]")
+{
+    int keys[] = { 4, 8, 1, 9, 0, 3, 7, 2, 6, 5 };
+
+    SECTION("comparator instance") {
+        LIB::map<int, int, direction> m ((direction(true)));
+        for (int i = 0; i < 5; ++i) {
+            m.insert(std::make_pair(keys[i], i));
+            m.emplace(keys[i + 5], i + 5);
+        }
+        m.insert(m.begin(), std::make_pair(10, 10));
+        m.emplace_hint(m.end(), -1, -1);
+        int expected = 10;
+        for (LIB::map<int, int, direction>::iterator it = m.begin(); it != m.end(); ++it)
+            REQUIRE( it->first == expected-- );
+
+        // copies & moves keep the comparator
+        LIB::map<int, int, direction> copy (m);
+        copy[20] = 20;
+        REQUIRE( copy.begin()->first == 20 );
+        LIB::map<int, int, direction> moved (std::move(copy));
+        moved[15] = 15;
+        REQUIRE( (++moved.begin())->first == 15 );
+    }
+    SECTION("function pointer comparator") {
+        LIB::map<int, int, bool (*)(int, int)> m (greater_int);
+        for (int i = 0; i < 10; ++i)
+            m.insert(std::make_pair(keys[i], i));
+        m.emplace(11, 11);
+        REQUIRE( m.size() == 11 );
+        REQUIRE( m.begin()->first == 11 );
+        REQUIRE( m.rbegin()->first == 0 );
+        REQUIRE( std::is_sorted(m.begin(), m.end(), m.value_comp()) );
+
+        int v[] = { 1, 5, 3 };
+        LIB::map<int, int, bool (*)(int, int)> r (m.begin(), m.end(), greater_int);
+        LIB::map<int, int, bool (*)(int, int)> s (greater_int);
+        for (int i = 0; i < 3; ++i)
+            s[v[i]] = i;
+        s = r;
+        REQUIRE( s.begin()->first == 11 );
+    }
+}
+
+TEST_CASE("maps hold values which are not default constructible", "[map][basics]")
+{
+    LIB::map<int, no_default> cnt;
+    REQUIRE( cnt.begin() == cnt.end() );
+    REQUIRE( cnt.rbegin() == cnt.rend() );
+    for (int i = 0; i < 20; ++i)
+        cnt.insert(std::make_pair((i * 7) % 20, no_default(i)));
+    REQUIRE( cnt.size() == 20 );
+    int key = 0;
+    for (LIB::map<int, no_default>::iterator it = cnt.begin(); it != cnt.end(); ++it)
+        REQUIRE( it->first == key++ );
+    for (LIB::map<int, no_default>::reverse_iterator it = cnt.rbegin(); it != cnt.rend(); ++it)
+        REQUIRE( it->first == --key );
+    REQUIRE( (--cnt.end())->first == 19 );
+
+    LIB::map<int, no_default> copy (cnt);
+    copy.erase(copy.begin());
+    copy.erase(--copy.end());
+    REQUIRE( copy.begin()->first == 1 );
+    REQUIRE( copy.rbegin()->first == 18 );
+}
+
+TEST_CASE("map swap keeps iterators to the elements valid", "[map][modifiers]")
+{
+    LIB::map<int, int> lhs;
+    LIB::map<int, int> rhs;
+    for (int i = 0; i < 10; ++i)
+        lhs[i] = i;
+    LIB::map<int, int>::iterator first = lhs.begin();
+    LIB::map<int, int>::iterator last = --lhs.end();
+
+    lhs.swap(rhs);
+    REQUIRE( lhs.empty() );
+    REQUIRE( lhs.begin() == lhs.end() );
+    REQUIRE( first == rhs.begin() );
+    REQUIRE( last == --rhs.end() );
+    REQUIRE( ++last == rhs.end() );
+    REQUIRE( rhs.find(5)->second == 5 );
+
+    lhs[42] = 42;
+    rhs.swap(lhs);
+    REQUIRE( rhs.size() == 1 );
+    REQUIRE( rhs.begin()->first == 42 );
+    REQUIRE( lhs.lower_bound(3)->first == 3 );
+    REQUIRE( lhs.upper_bound(9) == lhs.end() );
+    lhs.erase(first);
+    REQUIRE( lhs.begin()->first == 1 );
+    REQUIRE( lhs.size() == 9 );
+}
@@ -4,6 +4,8 @@
 #include <map>
 #include <set>
 #include <list>
+#include <vector>
+#include <algorithm>
 
 #include <iostream>
 
@@ -110,3 +112,118 @@ TEST_CASE("multiset works correctly", "[multiset]")
 
     REQUIRE( mset.find(127) == mset.end() );
 }
+
+TEST_CASE("multimap & multiset bounds match the stl", "[multimap][multiset][operations]")
+{
+    std::multimap<int, int> stl_mmap;
+    std::multiset<int> stl_mset;
+    LIB::multimap<int, int> mmap;
+    LIB::multiset<int> mset;
+
+    for (int i = 0; i < 2000; ++i) {
+        int key = rand() % 300;
+        stl_mmap.insert(std::make_pair(key, i));
+        mmap.insert(std::make_pair(key, i));
+        stl_mset.insert(key);
+        mset.insert(key);
+    }
+    const LIB::multimap<int, int>& cmmap = mmap;
+    for (int key = -1; key <= 301; ++key) {
+        REQUIRE( (unsigned)std::distance(mmap.begin(), mmap.lower_bound(key)) == (unsigned)std::distance(stl_mmap.begin(), stl_mmap.lower_bound(key)) );
+        REQUIRE( (unsigned)std::distance(mmap.begin(), mmap.upper_bound(key)) == (unsigned)std::distance(stl_mmap.begin(), stl_mmap.upper_bound(key)) );
+        REQUIRE( (unsigned)std::distance(mset.begin(), mset.lower_bound(key)) == (unsigned)std::distance(stl_mset.begin(), stl_mset.lower_bound(key)) );
+        REQUIRE( (unsigned)std::distance(mset.begin(), mset.upper_bound(key)) == (unsigned)std::distance(stl_mset.begin(), stl_mset.upper_bound(key)) );
+
+        auto eq = cmmap.equal_range(key);
+        REQUIRE(( eq.first == cmmap.lower_bound(key) ));
+        REQUIRE(( eq.second == cmmap.upper_bound(key) ));
+        REQUIRE( mmap.count(key) == stl_mmap.count(key) );
+        REQUIRE( mset.count(key) == stl_mset.count(key) );
+    }
+}
+
+// the comparator holds state, a default constructed one sorts ascending
+struct direction
+{
+    bool descending;
+
+    direction (bool desc = false) : descending(desc) {}
+    bool operator() (int a, int b) const { return descending ? b < a : a < b; }
+};
+
+static bool greater_int (int a, int b) { return a > b; }
+
+TEST_CASE("multimap & multiset lookups use the comparator they were built with", "[multimap][multiset][operations]")
+{
+    LIB::multimap<int, int, direction> mm ((direction(true)));
+    LIB::multiset<int, bool (*)(int, int)> ms (greater_int);
+    for (int i = 0; i < 10; ++i) {
+        mm.insert(std::make_pair(i / 2, i));
+        ms.insert(i / 2);
+    }
+    REQUIRE( mm.begin()->first == 4 );
+    REQUIRE( mm.lower_bound(2)->second == 4 );
+    REQUIRE( mm.upper_bound(2)->first == 1 );
+    REQUIRE( mm.count(3) == 2 );
+    REQUIRE( std::distance(mm.equal_range(3).first, mm.equal_range(3).second) == 2 );
+    REQUIRE( *ms.begin() == 4 );
+    REQUIRE( *ms.upper_bound(2) == 1 );
+    REQUIRE( ms.count(0) == 2 );
+    REQUIRE( ms.erase(0) == 2 );
+    REQUIRE( *ms.rbegin() == 1 );
+}
+
+#ifndef VERIFY_UNIT_TESTS
+TEST_CASE("multiset order statistics account for duplicates", "[multiset][operations]")
+{
+    LIB::multiset<int> mset;
+    std::multiset<int> stl_mset;
+    for (int i = 0; i < 2000; ++i) {
+        int key = rand() % 100;
+        mset.insert(key);
+        stl_mset.insert(key);
+    }
+    for (int key = -1; key <= 101; ++key) {
+        REQUIRE( mset.rank(key) == (size_t)std::distance(stl_mset.begin(), stl_mset.lower_bound(key)) );
+        REQUIRE( mset.count_range(key, key + 10) == (size_t)std::distance(stl_mset.lower_bound(key), stl_mset.lower_bound(key + 10)) );
+    }
+    size_t n = 0;
+    for (auto it = stl_mset.begin(); it != stl_mset.end(); ++it, ++n)
+        REQUIRE( *mset.select(n) == *it );
+}
+#endif
+
+TEST_CASE("multimap range construction keeps duplicates in order", "[multimap][basics]")
+{
+    std::vector<std::pair<int, int> > v;
+    for (int i = 0; i < 600; ++i)
+        v.push_back(std::make_pair(i / 3, i));
+    v.push_back(std::make_pair(7, -1));
+
+    std::multimap<int, int> stl_mmap (v.begin(), v.end());
+    LIB::multimap<int, int> mmap (v.begin(), v.end());
+    REQUIRE( mmap.size() == stl_mmap.size() );
+    REQUIRE( std::equal(stl_mmap.begin(), stl_mmap.end(), mmap.begin()) );
+    REQUIRE( mmap.count(7) == 4 );
+}
+
+TEST_CASE("multimap & multiset emplace keep duplicates in order", "[multimap][multiset][modifiers]")
+{
+    LIB::multimap<int, std::string> mm;
+    std::multimap<int, std::string> stl_mm;
+    LIB::multiset<std::string> ms;
+    std::multiset<std::string> stl_ms;
+    for (int i = 0; i < 60; ++i) {
+        int k = i % 7;
+        REQUIRE( mm.emplace(k, std::string(i, 'x'))->second == stl_mm.emplace(k, std::string(i, 'x'))->second );
+        REQUIRE( *ms.emplace(k, 'y') == *stl_ms.emplace(k, 'y') );
+    }
+    mm.emplace_hint(mm.end(), 7, "hint");
+    stl_mm.emplace_hint(stl_mm.end(), 7, "hint");
+    REQUIRE( std::equal(mm.begin(), mm.end(), stl_mm.begin()) );
+    REQUIRE( std::equal(ms.begin(), ms.end(), stl_ms.begin()) );
+
+    LIB::multimap<int, std::string> moved (std::move(mm));
+    REQUIRE( mm.empty() );
+    REQUIRE( moved.size() == stl_mm.size() );
+}
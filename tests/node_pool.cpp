@@ -0,0 +1,181 @@
+#include "../srcs/utils/node_pool.hpp"
+#include "../srcs/list/list.hpp"
+#include "../srcs/map/map.hpp"
+#include "../srcs/set/set.hpp"
+#include "../srcs/multimap/multimap.hpp"
+#include "../srcs/multiset/multiset.hpp"
+#include "catch.hpp"
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <algorithm>
+#include <vector>
+
+// ft::node_pool has no stl counterpart
+#ifndef VERIFY_UNIT_TESTS
+
+TEST_CASE("node_pool recycles freed nodes", "[node_pool]")
+{
+    ft::node_pool<std::string> pool;
+    std::string* a = pool.allocate(1);
+    std::string* b = pool.allocate(1);
+    REQUIRE( a != b );
+    pool.construct(a, "node");
+    REQUIRE( *a == "node" );
+    pool.destroy(a);
+    pool.deallocate(a, 1);
+    REQUIRE( pool.allocate(1) == a );
+
+    // copies share the pool, rebinding back finds it again
+    ft::node_pool<std::string> copy (pool);
+    ft::node_pool<int> other (pool);
+    ft::node_pool<std::string> rebound (other);
+    REQUIRE( copy == pool );
+    REQUIRE( rebound == pool );
+    REQUIRE( ft::node_pool<std::string>() != pool );
+    copy.deallocate(b, 1);
+    REQUIRE( pool.allocate(1) == b );
+
+    // arrays bypass the slabs
+    std::string* arr = pool.allocate(10);
+    pool.deallocate(arr, 10);
+    pool.deallocate(a, 1);
+    pool.deallocate(b, 1);
+}
+
+TEST_CASE("list works with a node_pool", "[node_pool][list]")
+{
+    typedef ft::list<std::string, ft::node_pool<std::string> > pool_list;
+
+    ft::node_pool<std::string> pool;
+    pool_list l (pool);
+    std::list<std::string> stl;
+    for (int i = 0; i < 2000; ++i) {
+        std::string s = std::to_string(rand() % 500);
+        if (i % 3 == 0) {
+            l.push_front(s);
+            stl.push_front(s);
+        } else {
+            l.push_back(s);
+            stl.push_back(s);
+        }
+        if (i % 5 == 0) {
+            l.pop_front();
+            stl.pop_front();
+        }
+    }
+    REQUIRE( std::equal(stl.begin(), stl.end(), l.begin()) );
+
+    pool_list copy (l);
+    copy.sort();
+    stl.sort();
+    copy.unique();
+    stl.unique();
+    REQUIRE( std::equal(stl.begin(), stl.end(), copy.begin()) );
+
+    // lists built from the same pool can exchange nodes
+    pool_list other (pool);
+    other.push_back("other");
+    size_t spliced_size = l.size() + other.size();
+    other.splice(other.begin(), l);
+    REQUIRE( l.empty() );
+    REQUIRE( other.size() == spliced_size );
+    other.swap(copy);
+    REQUIRE( copy.size() == spliced_size );
+    copy.clear();
+    REQUIRE( copy.empty() );
+}
+
+TEST_CASE("tree containers work with a node_pool", "[node_pool][map][set]")
+{
+    typedef ft::map<int, std::string, std::less<int>, ft::node_pool<std::pair<const int, std::string> > > pool_map;
+    typedef ft::multiset<int, std::less<int>, ft::node_pool<int> > pool_multiset;
+
+    pool_map map;
+    std::map<int, std::string> stl_map;
+    pool_multiset mset;
+    std::multiset<int> stl_mset;
+    for (int i = 0; i < 5000; ++i) {
+        int key = rand() % 1000;
+        map[key] = std::to_string(i);
+        stl_map[key] = std::to_string(i);
+        mset.insert(key);
+        stl_mset.insert(key);
+        if (i % 2) {
+            key = rand() % 1000;
+            REQUIRE( map.erase(key) == stl_map.erase(key) );
+            REQUIRE( mset.erase(key) == stl_mset.erase(key) );
+        }
+    }
+    REQUIRE( map.size() == stl_map.size() );
+    REQUIRE( std::equal(stl_map.begin(), stl_map.end(), map.begin()) );
+    REQUIRE( std::equal(stl_mset.begin(), stl_mset.end(), mset.begin()) );
+
+    pool_map copy (map);
+    pool_map assigned;
+    assigned[-1] = "gone";
+    assigned = copy;
+    copy.clear();
+    map.swap(assigned);
+    REQUIRE( copy.empty() );
+    REQUIRE( std::equal(stl_map.begin(), stl_map.end(), map.begin()) );
+    REQUIRE( std::equal(stl_map.begin(), stl_map.end(), assigned.begin()) );
+
+    ft::set<int, std::less<int>, ft::node_pool<int> > set (stl_mset.begin(), stl_mset.end());
+    ft::multimap<int, int, std::less<int>, ft::node_pool<std::pair<const int, int> > > mmap;
+    for (std::multiset<int>::iterator it = stl_mset.begin(); it != stl_mset.end(); ++it)
+        mmap.insert(std::make_pair(*it, 0));
+    REQUIRE( set.size() == map.size() );
+    REQUIRE( mmap.size() == mset.size() );
+}
+
+TEST_CASE("tree containers built from one node_pool share its slabs", "[node_pool][map][set]")
+{
+    typedef ft::node_pool<std::pair<const int, int> > pool_type;
+    typedef ft::map<int, int, std::less<int>, pool_type> pool_map;
+
+    pool_type pool;
+    pool_map a (std::less<int>(), pool);
+    pool_map b (std::less<int>(), pool);
+    a[1] = 1;
+    const int* freed = &a.begin()->first;
+    a.erase(1);
+    b[2] = 2;
+    REQUIRE( &b.begin()->first == freed );
+
+    ft::set<int, std::less<int>, ft::node_pool<int> > s1 ((std::less<int>()), ft::node_pool<int>(pool));
+    ft::multiset<int, std::less<int>, ft::node_pool<int> > s2 ((std::less<int>()), ft::node_pool<int>(pool));
+    s1.insert(7);
+    const int* node = &*s1.begin();
+    s1.clear();
+    s2.insert(8);
+    REQUIRE( &*s2.begin() == node );
+}
+
+#ifdef FT_HAS_CXX11
+struct alignas(64) wide
+{
+    char c[8];
+};
+
+TEST_CASE("node_pool keeps the alignment of over-aligned types", "[node_pool]")
+{
+    ft::node_pool<wide> pool;
+    std::vector<wide*> slots;
+    for (int i = 0; i < 100; ++i) {
+        slots.push_back(pool.allocate(1));
+        REQUIRE( reinterpret_cast<size_t>(slots.back()) % 64 == 0 );
+    }
+    for (size_t i = 0; i < slots.size(); ++i)
+        pool.deallocate(slots[i], 1);
+
+    ft::list<wide, ft::node_pool<wide> > l;
+    for (int i = 0; i < 100; ++i)
+        l.push_back(wide());
+    for (ft::list<wide, ft::node_pool<wide> >::iterator it = l.begin(); it != l.end(); ++it)
+        REQUIRE( reinterpret_cast<size_t>(&*it) % 64 == 0 );
+}
+#endif
+
+#endif
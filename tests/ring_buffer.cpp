@@ -0,0 +1,249 @@
+#include "../srcs/ring_buffer/ring_buffer.hpp"
+#include "../srcs/queue/queue.hpp"
+#include "../srcs/stack/stack.hpp"
+#include "catch.hpp"
+#include <deque>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+// ft::ring_buffer has no stl counterpart
+#ifndef VERIFY_UNIT_TESTS
+
+typedef ft::ring_buffer<std::string> ring_strings;
+
+static std::string make_string (int i)
+{
+    return std::string(20, 'a' + i % 26) + std::to_string(i);
+}
+
+TEST_CASE("ring_buffer behaves like a deque at both ends", "[ring_buffer][modifiers]")
+{
+    ring_strings cnt;
+    std::deque<std::string> stl_cnt;
+    REQUIRE( cnt.empty() );
+    REQUIRE( cnt.capacity() == 0 );
+    REQUIRE( cnt.begin() == cnt.end() );
+    REQUIRE( cnt.rbegin() == cnt.rend() );
+
+    for (int round = 0; round < 5; ++round) {
+        for (int i = 0; i < 100; ++i) {
+            cnt.push_back(make_string(i));
+            stl_cnt.push_back(make_string(i));
+            if (i % 3 == 0) {
+                cnt.push_front(make_string(-i));
+                stl_cnt.push_front(make_string(-i));
+            }
+            if (i % 5 == 0) {
+                cnt.pop_front();
+                stl_cnt.pop_front();
+            }
+        }
+        for (int i = 0; i < 30; ++i) {
+            cnt.pop_back();
+            stl_cnt.pop_back();
+        }
+        REQUIRE( cnt.size() == stl_cnt.size() );
+        REQUIRE( std::equal(stl_cnt.begin(), stl_cnt.end(), cnt.begin()) );
+        REQUIRE( std::equal(stl_cnt.rbegin(), stl_cnt.rend(), cnt.rbegin()) );
+        for (size_t i = 0; i < stl_cnt.size(); ++i)
+            REQUIRE( cnt[i] == stl_cnt[i] );
+        REQUIRE( cnt.front() == stl_cnt.front() );
+        REQUIRE( cnt.back() == stl_cnt.back() );
+        REQUIRE( cnt.end() - cnt.begin() == static_cast<long>(stl_cnt.size()) );
+    }
+    // the capacity is always a power of two
+    REQUIRE( (cnt.capacity() & (cnt.capacity() - 1)) == 0 );
+    REQUIRE( cnt.capacity() >= cnt.size() );
+    REQUIRE_THROWS_AS( cnt.at(cnt.size()), std::out_of_range );
+
+    // a value referring to an element which is moved or dropped
+    while (!cnt.full())
+        cnt.push_back(cnt.front());
+    cnt.push_back(cnt.front());
+    REQUIRE( cnt.back() == cnt.front() );
+}
+
+TEST_CASE("ring_buffer construction & assignation", "[ring_buffer][basics]")
+{
+    ring_strings filled (5, "x");
+    REQUIRE( filled.size() == 5 );
+    REQUIRE( filled.capacity() == 8 );
+    REQUIRE( std::count(filled.begin(), filled.end(), "x") == 5 );
+
+    std::deque<std::string> src;
+    for (int i = 0; i < 20; ++i)
+        src.push_back(make_string(i));
+    ring_strings range (src.begin(), src.end());
+    REQUIRE( std::equal(src.begin(), src.end(), range.begin()) );
+
+    range.pop_front();
+    range.push_back("last");
+    ring_strings copy (range);
+    REQUIRE( copy == range );
+    REQUIRE( copy.capacity() == range.capacity() );
+    filled = range;
+    REQUIRE( filled == range );
+    REQUIRE( filled.front() == make_string(1) );
+    REQUIRE( filled < ring_strings(1, "z") );
+
+    filled.assign(3, filled[1]);
+    REQUIRE( filled.size() == 3 );
+    REQUIRE( filled.back() == make_string(2) );
+    filled.resize(6, "y");
+    REQUIRE( filled.back() == "y" );
+    filled.resize(1);
+    REQUIRE( filled.size() == 1 );
+
+    ring_strings moved (std::move(range));
+    REQUIRE( range.empty() );
+    REQUIRE( moved == copy );
+    filled.swap(moved);
+    REQUIRE( filled == copy );
+    REQUIRE( moved.size() == 1 );
+}
+
+TEST_CASE("ring_buffer in overwrite mode keeps the latest elements", "[ring_buffer][modifiers]")
+{
+    ft::ring_buffer<int> history;
+    history.reserve(5);
+    history.set_overwrite(true);
+    REQUIRE( history.capacity() == 8 );
+    REQUIRE( history.overwrite() );
+
+    for (int i = 0; i < 100; ++i)
+        history.push_back(i);
+    REQUIRE( history.capacity() == 8 );
+    REQUIRE( history.size() == 8 );
+    for (int i = 0; i < 8; ++i)
+        REQUIRE( history[i] == 92 + i );
+
+    history.push_front(-1);
+    REQUIRE( history.size() == 8 );
+    REQUIRE( history.front() == -1 );
+    REQUIRE( history.back() == 98 );
+
+    ft::ring_buffer<int> assigned;
+    assigned = history;
+    REQUIRE( assigned.overwrite() );
+    REQUIRE( assigned.capacity() == 8 );
+    assigned.push_back(99);
+    REQUIRE( assigned.size() == 8 );
+    REQUIRE( assigned.front() == 92 );
+    REQUIRE( assigned.back() == 99 );
+
+    ft::ring_buffer<std::unique_ptr<int> > owners;
+    owners.reserve(2);
+    owners.set_overwrite(true);
+    for (int i = 0; i < 5; ++i)
+        owners.emplace_back(new int(i));
+    owners.emplace_front(new int(-1));
+    REQUIRE( owners.size() == 2 );
+    REQUIRE( *owners.front() == -1 );
+    REQUIRE( *owners.back() == 3 );
+}
+
+TEST_CASE("ring_buffer spans cover its elements in order", "[ring_buffer][element access]")
+{
+    ft::ring_buffer<int> cnt;
+    REQUIRE( cnt.first_span().second == 0 );
+    REQUIRE( cnt.second_span().second == 0 );
+
+    cnt.reserve(16);
+    int next = 0;
+    for (int round = 0; round < 40; ++round) {
+        while (cnt.size() < 11)
+            cnt.push_back(next++);
+        const ft::ring_buffer<int>& ccnt = cnt;
+        ft::ring_buffer<int>::const_span first = ccnt.first_span();
+        ft::ring_buffer<int>::const_span second = ccnt.second_span();
+        REQUIRE( first.second + second.second == cnt.size() );
+        REQUIRE( first.first == &cnt.front() );
+        for (size_t i = 0; i < first.second; ++i)
+            REQUIRE( first.first[i] == cnt[i] );
+        for (size_t i = 0; i < second.second; ++i)
+            REQUIRE( second.first[i] == cnt[first.second + i] );
+        // a partial write consumed some of the elements
+        size_t written = round % 7;
+        int expected = cnt[written];
+        cnt.pop_front_n(written);
+        REQUIRE( cnt.front() == expected );
+    }
+    REQUIRE( cnt.capacity() == 16 );
+}
+
+TEST_CASE("ring_buffer as the container of queue & stack", "[ring_buffer][stack][queue]")
+{
+    ft::queue<std::string, ring_strings> q;
+    ft::stack<std::string, ring_strings> st;
+    for (int i = 0; i < 50; ++i) {
+        q.push(make_string(i));
+        st.push(make_string(i));
+    }
+    for (int i = 0; i < 50; ++i) {
+        REQUIRE( q.front() == make_string(i) );
+        REQUIRE( st.top() == make_string(49 - i) );
+        q.pop();
+        st.pop();
+    }
+    REQUIRE( q.empty() );
+    REQUIRE( st.empty() );
+}
+
+
+// a type without a move constructor, whose copies may throw
+struct legacy_int
+{
+    static int copies_left;
+    static int alive;
+    int n;
+
+    legacy_int (int i = 0) : n(i) { ++alive; }
+    legacy_int (const legacy_int& x) : n(x.n)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("legacy_int");
+        ++alive;
+    }
+    legacy_int& operator= (const legacy_int& x) { n = x.n; return *this; }
+    ~legacy_int() { n = -1; --alive; }
+};
+
+int legacy_int::copies_left = 0;
+int legacy_int::alive = 0;
+
+TEST_CASE("ring_buffer growth keeps the elements when a copy throws", "[ring_buffer][modifiers]")
+{
+    legacy_int::copies_left = 1000;
+    {
+        // the elements wrap around the end of the buffer
+        ft::ring_buffer<legacy_int> cnt;
+        for (int i = 0; i < 6; ++i)
+            cnt.push_back(legacy_int(i + 2));
+        while (!cnt.full())
+            cnt.push_back(legacy_int(int(cnt.size()) + 2));
+        cnt.pop_back();
+        cnt.pop_back();
+        cnt.push_front(legacy_int(1));
+        cnt.push_front(legacy_int(0));
+        size_t size = cnt.size();
+        REQUIRE( cnt.full() );
+
+        legacy_int::copies_left = 5;
+        REQUIRE_THROWS_AS( cnt.push_back(legacy_int(-1)), std::runtime_error );
+        REQUIRE( legacy_int::alive == static_cast<int>(size) );
+        REQUIRE( cnt.size() == size );
+        for (size_t i = 0; i < size; ++i)
+            REQUIRE( cnt[i].n == static_cast<int>(i) );
+
+        legacy_int::copies_left = 1000;
+        cnt.push_back(legacy_int(-1));
+        REQUIRE( cnt.size() == size + 1 );
+        REQUIRE( cnt.front().n == 0 );
+        REQUIRE( cnt.back().n == -1 );
+    }
+    REQUIRE( legacy_int::alive == 0 );
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include <array>
 #include <list>
 #include <string>
+#include <stdexcept>
 
 #ifdef VERIFY_UNIT_TESTS
 # define LIB std
@@ -502,3 +503,84 @@ TEST_CASE("set equal_range works as expected", "[set][operations]")
     REQUIRE(( cmyset.equal_range(50).first == cmyset.end() ));
     REQUIRE(( cmyset.equal_range(50).second == cmyset.end() ));
 }
+
+static bool greater_int (int a, int b) { return a > b; }
+
+TEST_CASE("set lookups use the comparator the set was built with", "[set][operations]")
+{
+    int v[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+    LIB::set<int, bool (*)(int, int)> s (v, v + 8, greater_int);
+    REQUIRE( s.size() == 7 );
+    REQUIRE( *s.begin() == 9 );
+    REQUIRE( *s.lower_bound(7) == 6 );
+    REQUIRE( *s.upper_bound(5) == 4 );
+    REQUIRE( s.find(2) != s.end() );
+    REQUIRE( s.find(7) == s.end() );
+    REQUIRE( s.value_comp() == greater_int );
+}
+
+// copying one throws once copies_left reaches 0
+struct fragile
+{
+    static int copies_left;
+    static int alive;
+    int n;
+
+    fragile (int n) : n(n) { ++alive; }
+    fragile (const fragile& x) : n(x.n)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("fragile");
+        ++alive;
+    }
+    ~fragile() { --alive; }
+
+    bool operator< (const fragile& x) const { return n < x.n; }
+};
+
+int fragile::copies_left = 0;
+int fragile::alive = 0;
+
+TEST_CASE("set insert keeps no element it failed to copy", "[set][modifiers]")
+{
+    {
+        fragile::copies_left = 100;
+        std::list<fragile> src;
+        for (int i = 0; i < 10; ++i)
+            src.push_back(fragile(i));
+        fragile::copies_left = 5;
+        LIB::set<fragile> s;
+        REQUIRE_THROWS_AS( s.insert(src.begin(), src.end()), std::runtime_error );
+        REQUIRE( fragile::alive == static_cast<int>(src.size() + s.size()) );
+
+        fragile::copies_left = 100;
+        s.insert(src.begin(), src.end());
+        REQUIRE( s.size() == 10 );
+        REQUIRE( s.begin()->n == 0 );
+    }
+    REQUIRE( fragile::alive == 0 );
+}
+
+TEST_CASE("set assignment keeps no element it failed to copy", "[set][operators]")
+{
+    {
+        fragile::copies_left = 100;
+        LIB::set<fragile> src;
+        LIB::set<fragile> dst;
+        for (int i = 0; i < 20; ++i)
+            src.insert(fragile(i));
+        for (int i = 0; i < 8; ++i)
+            dst.insert(fragile(-i));
+        fragile::copies_left = 12;
+        REQUIRE_THROWS_AS( dst = src, std::runtime_error );
+        REQUIRE( fragile::alive == static_cast<int>(src.size() + dst.size()) );
+        dst.insert(fragile(100));
+        REQUIRE( dst.count(fragile(100)) == 1 );
+
+        fragile::copies_left = 100;
+        dst = src;
+        REQUIRE( dst.size() == 20 );
+        REQUIRE( dst.rbegin()->n == 19 );
+    }
+    REQUIRE( fragile::alive == 0 );
+}
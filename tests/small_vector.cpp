@@ -0,0 +1,150 @@
+#include "../srcs/vector/small_vector.hpp"
+#include "catch.hpp"
+#include <vector>
+#include <string>
+#include <memory>
+
+// ft::small_vector has no stl counterpart
+#ifndef VERIFY_UNIT_TESTS
+
+typedef ft::small_vector<std::string, 4> small_strings;
+
+static small_strings make_strings (int n)
+{
+    small_strings ret;
+    for (int i = 0; i < n; ++i)
+        ret.push_back(std::string(i + 20, 'a' + i));
+    return ret;
+}
+
+static bool same_strings (const small_strings& cnt, int n)
+{
+    if (cnt.size() != static_cast<size_t>(n))
+        return false;
+    for (int i = 0; i < n; ++i) {
+        if (cnt[i] != std::string(i + 20, 'a' + i))
+            return false;
+    }
+    return true;
+}
+
+TEST_CASE("small_vector stores up to N elements inline", "[small_vector][basics]")
+{
+    small_strings cnt;
+    REQUIRE( cnt.is_inline() );
+    REQUIRE( cnt.capacity() == 4 );
+
+    for (int i = 0; i < 4; ++i)
+        cnt.push_back(std::string(i + 20, 'a' + i));
+    REQUIRE( cnt.is_inline() );
+    REQUIRE( same_strings(cnt, 4) );
+
+    cnt.push_back(std::string(24, 'e'));
+    REQUIRE( !cnt.is_inline() );
+    REQUIRE( cnt.capacity() > 4 );
+    REQUIRE( same_strings(cnt, 5) );
+
+    cnt.insert(cnt.begin() + 1, 3, "x");
+    cnt.erase(cnt.begin() + 1, cnt.begin() + 4);
+    REQUIRE( same_strings(cnt, 5) );
+
+    cnt.clear();
+    REQUIRE( cnt.empty() );
+}
+
+TEST_CASE("small_vector copies & moves in both states", "[small_vector][basics]")
+{
+    int n = GENERATE(0, 3, 4, 5, 40);
+    small_strings src = make_strings(n);
+
+    SECTION("copy") {
+        small_strings copy (src);
+        REQUIRE( same_strings(copy, n) );
+        REQUIRE( same_strings(src, n) );
+        small_strings assigned = make_strings(7);
+        assigned = src;
+        REQUIRE( same_strings(assigned, n) );
+    }
+    SECTION("move") {
+        bool was_inline = src.is_inline();
+        small_strings moved (std::move(src));
+        REQUIRE( same_strings(moved, n) );
+        REQUIRE( moved.is_inline() == was_inline );
+        REQUIRE( src.empty() );
+        REQUIRE( src.is_inline() );
+
+        small_strings assigned = make_strings(9);
+        assigned = std::move(moved);
+        REQUIRE( same_strings(assigned, n) );
+        REQUIRE( moved.empty() );
+        moved.push_back("reused");
+        REQUIRE( moved.back() == "reused" );
+    }
+}
+
+TEST_CASE("small_vector swaps inline & heap contents", "[small_vector][modifiers]")
+{
+    int lhs_n = GENERATE(0, 2, 4, 6, 30);
+    int rhs_n = GENERATE(1, 4, 9);
+    small_strings lhs = make_strings(lhs_n);
+    small_strings rhs = make_strings(rhs_n);
+
+    lhs.swap(rhs);
+    REQUIRE( same_strings(lhs, rhs_n) );
+    REQUIRE( same_strings(rhs, lhs_n) );
+    ft::swap(lhs, rhs);
+    REQUIRE( same_strings(lhs, lhs_n) );
+    REQUIRE( same_strings(rhs, rhs_n) );
+}
+
+TEST_CASE("small_vector works with move only types", "[small_vector][modifiers]")
+{
+    ft::small_vector<std::unique_ptr<int>, 2> cnt;
+    for (int i = 0; i < 10; ++i)
+        cnt.emplace_back(new int(i));
+    cnt.emplace(cnt.begin(), new int(-1));
+    REQUIRE( *cnt.front() == -1 );
+    REQUIRE( *cnt.back() == 9 );
+
+    ft::small_vector<std::unique_ptr<int>, 2> small;
+    small.emplace_back(new int(42));
+    small.swap(cnt);
+    REQUIRE( small.size() == 11 );
+    REQUIRE( cnt.size() == 1 );
+    REQUIRE( cnt.is_inline() );
+    REQUIRE( *cnt[0] == 42 );
+}
+
+TEST_CASE("small_vector grows with the policy it is given", "[small_vector][capacity]")
+{
+    ft::small_vector<int, 4> by_default;
+    ft::small_vector<int, 4, std::allocator<int>, ft::doubling_growth> doubling;
+    for (int i = 0; i < 5; ++i) {
+        by_default.push_back(i);
+        doubling.push_back(i);
+    }
+    REQUIRE( by_default.capacity() == 6 );
+    REQUIRE( doubling.capacity() == 8 );
+    for (int i = 0; i < 5; ++i)
+        REQUIRE( doubling[i] == i );
+}
+
+struct alignas(64) wide_value
+{
+    int n;
+    wide_value (int n) : n(n) {}
+};
+
+TEST_CASE("small_vector aligns its inline buffer for T", "[small_vector][basics]")
+{
+    ft::small_vector<wide_value, 3> cnt;
+    cnt.push_back(wide_value(1));
+    REQUIRE( cnt.is_inline() );
+    REQUIRE( reinterpret_cast<size_t>(&cnt[0]) % 64 == 0 );
+    cnt.push_back(wide_value(2));
+    cnt.push_back(wide_value(3));
+    for (int i = 0; i < 3; ++i)
+        REQUIRE( cnt[i].n == i + 1 );
+}
+
+#endif
@@ -0,0 +1,245 @@
+#include "../srcs/spsc_queue/spsc_queue.hpp"
+#include "catch.hpp"
+#include <string>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <stdexcept>
+
+// ft::spsc_queue has no stl counterpart & needs C++11 atomics
+#if !defined(VERIFY_UNIT_TESTS) && defined(FT_HAS_CXX11)
+
+static std::string make_string (int i)
+{
+    return std::string(20, 'a' + i % 26) + std::to_string(i);
+}
+
+// a small chunk size walks many chunk boundaries
+typedef ft::spsc_queue< std::string, std::allocator<std::string>, ft::chunk_elements<4> > small_queue;
+
+TEST_CASE("spsc_queue behaves like a fifo on a single thread", "[spsc_queue][modifiers]")
+{
+    small_queue q;
+    std::string out;
+    REQUIRE( q.empty() );
+    REQUIRE_FALSE( q.try_pop(out) );
+
+    int pushed = 0;
+    int popped = 0;
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < round + 3; ++i)
+            REQUIRE( q.try_push(make_string(pushed++)) );
+        REQUIRE( q.size() == static_cast<size_t>(pushed - popped) );
+        for (int i = 0; i < round; ++i) {
+            REQUIRE( q.try_pop(out) );
+            REQUIRE( out == make_string(popped++) );
+        }
+    }
+    while (q.try_pop(out))
+        REQUIRE( out == make_string(popped++) );
+    REQUIRE( popped == pushed );
+    REQUIRE( q.empty() );
+
+    // the elements left in the queue are destroyed with it
+    ft::spsc_queue< std::unique_ptr<int>, std::allocator< std::unique_ptr<int> >, ft::chunk_elements<2> > owners;
+    for (int i = 0; i < 7; ++i)
+        REQUIRE( owners.try_emplace(new int(i)) );
+    std::unique_ptr<int> owner;
+    REQUIRE( owners.try_pop(owner) );
+    REQUIRE( *owner == 0 );
+}
+
+TEST_CASE("spsc_queue with a max_size & batches", "[spsc_queue][modifiers]")
+{
+    ft::spsc_queue< int, std::allocator<int>, ft::chunk_elements<4> > q (10);
+    REQUIRE( q.max_size() == 10 );
+    for (int i = 0; i < 10; ++i)
+        REQUIRE( q.try_push(i) );
+    REQUIRE_FALSE( q.try_push(10) );
+
+    int out[16];
+    REQUIRE( q.try_pop_n(out, 3) == 3 );
+    REQUIRE( out[2] == 2 );
+
+    int src[8] = { 10, 11, 12, 13, 14, 15, 16, 17 };
+    REQUIRE( q.try_push_n(src, 8) == 3 );
+    REQUIRE( q.try_push_n(src, 8) == 0 );
+    REQUIRE( q.try_pop_n(out, 16) == 10 );
+    for (int i = 0; i < 10; ++i)
+        REQUIRE( out[i] == i + 3 );
+    REQUIRE( q.try_pop_n(out, 16) == 0 );
+
+    std::vector<int> drained;
+    REQUIRE( q.try_push_n(src, 8) == 8 );
+    REQUIRE( q.try_pop_n(std::back_inserter(drained), 5) == 5 );
+    REQUIRE( drained.back() == 14 );
+}
+
+TEST_CASE("spsc_queue between two threads", "[spsc_queue][threads]")
+{
+    static const int n = 200000;
+    ft::spsc_queue< int, std::allocator<int>, ft::chunk_elements<64> > q (1000);
+
+    std::thread producer ([&q]() {
+        int batch[7];
+        int next = 0;
+        while (next < n) {
+            if (next % 3 == 0) {
+                int count = 0;
+                for (; count < 7 && next + count < n; ++count)
+                    batch[count] = next + count;
+                next += q.try_push_n(batch, count);
+            }
+            else if (q.try_push(next))
+                ++next;
+        }
+    });
+
+    // size may be read by a third thread, it never exceeds max_size
+    std::atomic<bool> done (false);
+    bool bounded = true;
+    std::thread observer ([&q, &done, &bounded]() {
+        while (!done.load())
+            bounded = bounded && q.size() <= 1000;
+    });
+
+    bool ordered = true;
+    int expected = 0;
+    int batch[5];
+    while (expected < n) {
+        size_t count = q.try_pop_n(batch, 5);
+        for (size_t i = 0; i < count; ++i)
+            ordered = ordered && batch[i] == expected++;
+        int val;
+        if (q.try_pop(val))
+            ordered = ordered && val == expected++;
+    }
+    producer.join();
+    done.store(true);
+    observer.join();
+    REQUIRE( ordered );
+    REQUIRE( bounded );
+    REQUIRE( expected == n );
+    REQUIRE( q.empty() );
+}
+
+// copying one in throws once copies_left reaches 0, assigning one out once
+// assigns_left does
+struct touchy_int
+{
+    static int copies_left;
+    static int assigns_left;
+    static int alive;
+    int n;
+
+    touchy_int (int i = 0) : n(i) { ++alive; }
+    touchy_int (const touchy_int& x) : n(x.n)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("touchy_int");
+        ++alive;
+    }
+    touchy_int& operator= (const touchy_int& x)
+    {
+        if (assigns_left-- == 0)
+            throw std::runtime_error("touchy_int");
+        n = x.n;
+        return *this;
+    }
+    ~touchy_int() { --alive; }
+};
+
+int touchy_int::copies_left = 0;
+int touchy_int::assigns_left = 0;
+int touchy_int::alive = 0;
+
+typedef ft::spsc_queue< touchy_int, std::allocator<touchy_int>, ft::chunk_elements<2> > touchy_queue;
+
+TEST_CASE("spsc_queue publishes nothing when a push throws", "[spsc_queue][modifiers]")
+{
+    touchy_int::copies_left = 1000;
+    touchy_int::assigns_left = 1000;
+    {
+        touchy_queue q;
+        std::vector<touchy_int> src;
+        for (int i = 0; i < 7; ++i)
+            src.push_back(touchy_int(i));
+        int alive = touchy_int::alive;
+
+        SECTION("try_push at a chunk boundary") {
+            REQUIRE( q.try_push(src[0]) );
+            REQUIRE( q.try_push(src[1]) );
+            for (int i = 0; i < 2; ++i) {
+                touchy_int::copies_left = 0;
+                REQUIRE_THROWS_AS( q.try_push(src[2]), std::runtime_error );
+            }
+            touchy_int::copies_left = 1000;
+            REQUIRE( q.size() == 2 );
+            REQUIRE( touchy_int::alive == alive + 2 );
+            for (int i = 2; i < 7; ++i)
+                REQUIRE( q.try_push(src[i]) );
+        }
+        SECTION("try_push_n across chunks") {
+            REQUIRE( q.try_push(src[0]) );
+            touchy_int::copies_left = 4;
+            REQUIRE_THROWS_AS( q.try_push_n(src.begin() + 1, 6), std::runtime_error );
+            touchy_int::copies_left = 1000;
+            REQUIRE( q.size() == 1 );
+            REQUIRE( touchy_int::alive == alive + 1 );
+            REQUIRE( q.try_push_n(src.begin() + 1, 6) == 6 );
+        }
+        touchy_int out;
+        for (int i = 0; i < 7; ++i) {
+            REQUIRE( q.try_pop(out) );
+            REQUIRE( out.n == i );
+        }
+        REQUIRE_FALSE( q.try_pop(out) );
+        // the elements left are destroyed with the queue
+        REQUIRE( q.try_push_n(src.begin(), 5) == 5 );
+    }
+    REQUIRE( touchy_int::alive == 0 );
+}
+
+TEST_CASE("spsc_queue keeps the element at the head when a pop throws", "[spsc_queue][modifiers]")
+{
+    touchy_int::copies_left = 1000;
+    touchy_int::assigns_left = 1000;
+    {
+        touchy_queue q;
+        std::vector<touchy_int> src;
+        for (int i = 0; i < 7; ++i)
+            src.push_back(touchy_int(i));
+        REQUIRE( q.try_push_n(src.begin(), 7) == 7 );
+        touchy_int out;
+
+        SECTION("try_pop at a chunk boundary") {
+            REQUIRE( q.try_pop(out) );
+            REQUIRE( q.try_pop(out) );
+            for (int i = 0; i < 2; ++i) {
+                touchy_int::assigns_left = 0;
+                REQUIRE_THROWS_AS( q.try_pop(out), std::runtime_error );
+            }
+            touchy_int::assigns_left = 1000;
+            REQUIRE( q.size() == 5 );
+            REQUIRE( q.try_pop(out) );
+            REQUIRE( out.n == 2 );
+        }
+        SECTION("try_pop_n across chunks") {
+            touchy_int outs[7];
+            touchy_int::assigns_left = 3;
+            REQUIRE_THROWS_AS( q.try_pop_n(outs, 7), std::runtime_error );
+            touchy_int::assigns_left = 1000;
+            REQUIRE( q.size() == 4 );
+            REQUIRE( outs[2].n == 2 );
+        }
+        for (int i = 3; i < 5; ++i) {
+            REQUIRE( q.try_pop(out) );
+            REQUIRE( out.n == i );
+        }
+        REQUIRE( q.size() == 2 );
+    }
+    REQUIRE( touchy_int::alive == 0 );
+}
+
+#endif
@@ -148,3 +148,24 @@ TEST_CASE("deque specific methods work as expected", "[container_adaptors][queue
         REQUIRE( my_cnt.front() == stl_cnt.front() );
     }
 }
+
+TEST_CASE("stack & queue move & emplace elements", "[stack][queue]")
+{
+    LIB::stack<std::string> st;
+    LIB::queue<std::string> q;
+    for (int i = 1; i < 10; ++i) {
+        st.emplace(i, 'x');
+        q.emplace(i, 'x');
+        std::string s (i, 'y');
+        st.push(std::move(s));
+    }
+    REQUIRE( st.top() == "yyyyyyyyy" );
+    REQUIRE( q.front() == "x" );
+
+    LIB::stack<std::string> moved_st (std::move(st));
+    LIB::queue<std::string> moved_q;
+    moved_q = std::move(q);
+    REQUIRE( moved_st.size() == 18 );
+    REQUIRE( moved_q.size() == 9 );
+    REQUIRE( moved_q.back() == "xxxxxxxxx" );
+}
@@ -0,0 +1,459 @@
+#include "../srcs/unrolled_list/unrolled_list.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// ft::unrolled_list has no stl counterpart, it is checked against std::list
+#ifndef VERIFY_UNIT_TESTS
+
+// tiny nodes go through many splits & merges
+typedef ft::unrolled_list<std::string, 4> small_list;
+typedef ft::unrolled_list<int, 8> int_list;
+
+static std::string make_string (int i)
+{
+    return std::string(20, 'a' + i % 26) + std::to_string(i);
+}
+
+template <class UnrolledList, class T>
+static bool same (const UnrolledList& l, const std::list<T>& ref)
+{
+    return l.size() == ref.size()
+        && std::equal(l.begin(), l.end(), ref.begin())
+        && std::equal(l.rbegin(), l.rend(), ref.rbegin());
+}
+
+// the number of nodes holding the elements
+template <class UnrolledList>
+static size_t count_nodes (const UnrolledList& l)
+{
+    size_t nodes = 0;
+    for (typename UnrolledList::const_iterator it = l.begin(); it != l.end(); ++it)
+        nodes += it.get_index() == 0;
+    return nodes;
+}
+
+TEST_CASE("unrolled_list basics", "[unrolled_list][basics]")
+{
+    small_list l;
+    REQUIRE( l.empty() );
+    REQUIRE( l.begin() == l.end() );
+    REQUIRE( l.rbegin() == l.rend() );
+    REQUIRE( l.node_size() == 4 );
+
+    std::list<std::string> ref;
+    for (int i = 0; i < 50; ++i) {
+        l.push_back(make_string(i));
+        ref.push_back(make_string(i));
+        l.push_front(make_string(-i));
+        ref.push_front(make_string(-i));
+    }
+    REQUIRE( same(l, ref) );
+    REQUIRE( l.front() == ref.front() );
+    REQUIRE( l.back() == ref.back() );
+    for (int i = 0; i < 20; ++i) {
+        l.pop_front();
+        ref.pop_front();
+        l.pop_back();
+        ref.pop_back();
+    }
+    REQUIRE( same(l, ref) );
+
+    small_list copy (l);
+    REQUIRE( copy == l );
+    copy.back() = "z";
+    REQUIRE( copy != l );
+    REQUIRE( l < copy );
+    REQUIRE( copy > l );
+
+    small_list moved (std::move(copy));
+    REQUIRE( copy.empty() );
+    REQUIRE( moved.back() == "z" );
+    moved.swap(l);
+    REQUIRE( moved.back() != "z" );
+    REQUIRE( l.back() == "z" );
+
+    l.assign(3, "x");
+    REQUIRE( l.size() == 3 );
+    l.resize(9, "y");
+    REQUIRE( l.size() == 9 );
+    REQUIRE( l.back() == "y" );
+    l.resize(2);
+    REQUIRE( l.size() == 2 );
+    REQUIRE( l.back() == "x" );
+    l.clear();
+    REQUIRE( l.empty() );
+
+    const small_list const_list (ref.begin(), ref.end());
+    REQUIRE( same(const_list, ref) );
+    small_list::const_iterator cit = const_list.begin();
+    REQUIRE( *cit == ref.front() );
+}
+
+TEST_CASE("unrolled_list inserts & erases like a list", "[unrolled_list][modifiers]")
+{
+    small_list l;
+    std::list<std::string> ref;
+    std::srand(42);
+
+    for (int round = 0; round < 2000; ++round) {
+        size_t pos = ref.empty() ? 0 : std::rand() % (ref.size() + 1);
+        small_list::iterator it = l.begin();
+        std::list<std::string>::iterator rit = ref.begin();
+        std::advance(it, pos);
+        std::advance(rit, pos);
+        int op = std::rand() % 10;
+        if (op < 5 || ref.size() < 4) {
+            std::string val = make_string(round);
+            REQUIRE( *l.insert(it, val) == val );
+            ref.insert(rit, val);
+        } else if (op < 7) {
+            if (rit == ref.end())
+                continue ;
+            small_list::iterator next = l.erase(it);
+            std::list<std::string>::iterator rnext = ref.erase(rit);
+            REQUIRE( (next == l.end()) == (rnext == ref.end()) );
+            if (rnext != ref.end())
+                REQUIRE( *next == *rnext );
+        } else if (op < 8) {
+            size_t n = std::rand() % (ref.size() - pos + 1);
+            small_list::iterator last = it;
+            std::list<std::string>::iterator rlast = rit;
+            std::advance(last, n);
+            std::advance(rlast, n);
+            small_list::iterator next = l.erase(it, last);
+            std::list<std::string>::iterator rnext = ref.erase(rit, rlast);
+            REQUIRE( (next == l.end()) == (rnext == ref.end()) );
+            if (rnext != ref.end())
+                REQUIRE( *next == *rnext );
+        } else {
+            l.insert(it, 3, make_string(round));
+            ref.insert(rit, 3, make_string(round));
+        }
+        REQUIRE( same(l, ref) );
+    }
+
+    // an element of the list can be inserted into it
+    l.insert(l.begin(), l.back());
+    ref.insert(ref.begin(), ref.back());
+    REQUIRE( same(l, ref) );
+}
+
+TEST_CASE("unrolled_list keeps its nodes dense", "[unrolled_list][modifiers]")
+{
+    int_list l;
+    for (int i = 0; i < 8000; ++i)
+        l.push_back(i);
+    REQUIRE( count_nodes(l) == 1000 );
+
+    // middle insertions split full nodes in halves
+    int_list::iterator mid = l.begin();
+    std::advance(mid, 4000);
+    for (int i = 0; i < 8000; ++i)
+        mid = l.insert(mid, -i);
+    REQUIRE( l.size() == 16000 );
+    REQUIRE( count_nodes(l) <= 16000 / 4 + 1 );
+
+    // erasing every other element merges the nodes left half full
+    for (int_list::iterator it = l.begin(); it != l.end(); ) {
+        it = l.erase(it);
+        if (it != l.end())
+            ++it;
+    }
+    REQUIRE( l.size() == 8000 );
+    REQUIRE( count_nodes(l) <= 8000 / 4 + 1 );
+}
+
+TEST_CASE("unrolled_list splices nodes", "[unrolled_list][operations]")
+{
+    std::list<std::string> ref0;
+    std::list<std::string> ref1;
+    for (int i = 0; i < 30; ++i) {
+        ref0.push_back(make_string(i));
+        ref1.push_back(make_string(100 + i));
+    }
+    small_list l0 (ref0.begin(), ref0.end());
+    small_list l1 (ref1.begin(), ref1.end());
+
+    SECTION("entire lists can be spliced") {
+        small_list::iterator it = l0.begin();
+        std::list<std::string>::iterator rit = ref0.begin();
+        std::advance(it, 13);
+        std::advance(rit, 13);
+        l0.splice(it, l1);
+        ref0.splice(rit, ref1);
+        REQUIRE( l1.empty() );
+        REQUIRE( same(l0, ref0) );
+
+        l1.splice(l1.end(), l0);
+        REQUIRE( l0.empty() );
+        REQUIRE( same(l1, ref0) );
+    }
+    SECTION("single elements can be spliced") {
+        for (int i = 0; i < 40; ++i) {
+            size_t from = std::rand() % ref1.size();
+            size_t to = std::rand() % (ref0.size() + 1);
+            small_list::iterator it = l1.begin();
+            small_list::iterator pos = l0.begin();
+            std::list<std::string>::iterator rit = ref1.begin();
+            std::list<std::string>::iterator rpos = ref0.begin();
+            std::advance(it, from);
+            std::advance(rit, from);
+            std::advance(pos, to);
+            std::advance(rpos, to);
+            if (i % 2) {
+                l0.splice(pos, l1, it);
+                ref0.splice(rpos, ref1, rit);
+            } else {
+                l1.splice(l1.begin(), l1, it);
+                ref1.splice(ref1.begin(), ref1, rit);
+            }
+            REQUIRE( same(l0, ref0) );
+            REQUIRE( same(l1, ref1) );
+            if (ref1.size() < 2)
+                break ;
+        }
+    }
+    SECTION("ranges can be spliced between & within lists") {
+        for (int i = 0; i < 40; ++i) {
+            size_t first = std::rand() % (ref0.size() + 1);
+            size_t last = first + std::rand() % (ref0.size() - first + 1);
+            small_list::iterator it = l0.begin();
+            small_list::iterator it_last = l0.begin();
+            std::list<std::string>::iterator rit = ref0.begin();
+            std::list<std::string>::iterator rit_last = ref0.begin();
+            std::advance(it, first);
+            std::advance(rit, first);
+            std::advance(it_last, last);
+            std::advance(rit_last, last);
+            if (i % 2) {
+                size_t to = std::rand() % (ref1.size() + 1);
+                small_list::iterator pos = l1.begin();
+                std::list<std::string>::iterator rpos = ref1.begin();
+                std::advance(pos, to);
+                std::advance(rpos, to);
+                l1.splice(pos, l0, it, it_last);
+                ref1.splice(rpos, ref0, rit, rit_last);
+            } else {
+                // a position outside of the range, possibly in its end node
+                size_t to = std::rand() % (ref0.size() - last + first + 1);
+                if (to >= first)
+                    to += last - first;
+                small_list::iterator pos = l0.begin();
+                std::list<std::string>::iterator rpos = ref0.begin();
+                std::advance(pos, to);
+                std::advance(rpos, to);
+                l0.splice(pos, l0, it, it_last);
+                ref0.splice(rpos, ref0, rit, rit_last);
+            }
+            REQUIRE( same(l0, ref0) );
+            REQUIRE( same(l1, ref1) );
+            std::swap(l0, l1);
+            std::swap(ref0, ref1);
+        }
+    }
+}
+
+TEST_CASE("unrolled_list removes elements", "[unrolled_list][operations]")
+{
+    std::list<int> ref;
+    for (int i = 0; i < 1000; ++i)
+        ref.push_back(std::rand() % 10);
+    int_list l (ref.begin(), ref.end());
+
+    l.remove(3);
+    ref.remove(3);
+    REQUIRE( same(l, ref) );
+
+    l.remove_if([](int x) { return x % 2 == 0; });
+    ref.remove_if([](int x) { return x % 2 == 0; });
+    REQUIRE( same(l, ref) );
+    REQUIRE( count_nodes(l) == (l.size() + 7) / 8 );
+
+    l.unique();
+    ref.unique();
+    REQUIRE( same(l, ref) );
+
+    l.push_back(9);
+    ref.push_back(9);
+    l.unique([](int a, int b) { return a + 2 == b; });
+    ref.unique([](int a, int b) { return a + 2 == b; });
+    REQUIRE( same(l, ref) );
+
+    // an element of the list can be removed by value
+    l.remove(l.front());
+    ref.remove(ref.front());
+    REQUIRE( same(l, ref) );
+
+    l.remove_if([](int) { return true; });
+    REQUIRE( l.empty() );
+    REQUIRE( l.begin() == l.end() );
+    l.push_back(1);
+    REQUIRE( l.size() == 1 );
+}
+
+struct alignas(64) wide_element
+{
+    int n;
+    wide_element (int n) : n(n) {}
+};
+
+TEST_CASE("unrolled_list aligns its elements for T", "[unrolled_list][basics]")
+{
+    ft::unrolled_list<wide_element, 4> l;
+    for (int i = 0; i < 20; ++i)
+        l.push_back(wide_element(i));
+    int expected = 0;
+    for (ft::unrolled_list<wide_element, 4>::iterator it = l.begin(); it != l.end(); ++it) {
+        REQUIRE( reinterpret_cast<size_t>(&*it) % 64 == 0 );
+        REQUIRE( it->n == expected++ );
+    }
+}
+
+// the predicate throws on its 500th call
+struct even_until_500
+{
+    int * calls;
+
+    bool operator() (int x) const
+    {
+        if (++*calls == 500)
+            throw std::runtime_error("even_until_500");
+        return x % 2 == 0;
+    }
+};
+
+TEST_CASE("unrolled_list stays valid when remove_if throws", "[unrolled_list][operations]")
+{
+    std::list<int> ref;
+    for (int i = 0; i < 1000; ++i)
+        ref.push_back(i);
+    int_list l (ref.begin(), ref.end());
+
+    // the 62 full nodes seen before the throw are compacted, the node the
+    // predicate threw on & the ones after are left as they were
+    int calls = 0;
+    even_until_500 pred = { &calls };
+    REQUIRE_THROWS_AS( l.remove_if(pred), std::runtime_error );
+    ref.remove_if([](int x) { return x < 496 && x % 2 == 0; });
+    REQUIRE( same(l, ref) );
+
+    l.push_back(1000);
+    ref.push_back(1000);
+    l.remove_if([](int x) { return x % 2 == 0; });
+    ref.remove_if([](int x) { return x % 2 == 0; });
+    REQUIRE( same(l, ref) );
+    REQUIRE( count_nodes(l) == (l.size() + 7) / 8 );
+}
+
+TEST_CASE("unrolled_list merges & sorts", "[unrolled_list][operations]")
+{
+    SECTION("sorting gives the same order as std::list") {
+        for (int n = 0; n < 1500; n += 149) {
+            std::list<int> ref;
+            for (int i = 0; i < n; ++i)
+                ref.push_back(std::rand() % 500);
+            int_list l (ref.begin(), ref.end());
+            l.sort();
+            ref.sort();
+            REQUIRE( same(l, ref) );
+            l.sort(std::greater<int>());
+            ref.sort(std::greater<int>());
+            REQUIRE( same(l, ref) );
+            l.sort(std::greater<int>());
+            REQUIRE( same(l, ref) );
+        }
+    }
+    SECTION("sorting & merging are stable") {
+        typedef std::pair<int, int> elem;
+        ft::unrolled_list<elem, 4> l0;
+        ft::unrolled_list<elem, 4> l1;
+        std::list<elem> ref0;
+        std::list<elem> ref1;
+        for (int i = 0; i < 500; ++i) {
+            l0.push_back(elem(std::rand() % 20, i));
+            l1.push_back(elem(std::rand() % 20, -i));
+        }
+        ref0.assign(l0.begin(), l0.end());
+        ref1.assign(l1.begin(), l1.end());
+
+        bool (*by_key)(const elem&, const elem&) = [](const elem& a, const elem& b) { return a.first < b.first; };
+        l0.sort(by_key);
+        l1.sort(by_key);
+        ref0.sort(by_key);
+        ref1.sort(by_key);
+        REQUIRE( same(l0, ref0) );
+        REQUIRE( same(l1, ref1) );
+
+        l0.merge(l1, by_key);
+        ref0.merge(ref1, by_key);
+        REQUIRE( l1.empty() );
+        REQUIRE( same(l0, ref0) );
+    }
+    SECTION("merging with or between empty lists") {
+        int_list l0;
+        int_list l1 (5, 10);
+        l0.merge(l1);
+        REQUIRE( l1.empty() );
+        REQUIRE( l0.size() == 5 );
+        l0.merge(l1);
+        l0.merge(l0);
+        REQUIRE( l0.size() == 5 );
+
+        int a[] = { 1, 2, 3 };
+        int b[] = { 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        int c[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        int_list l2 (a, a + 3);
+        int_list l3 (b, b + 9);
+        l3.merge(l2);
+        REQUIRE( std::equal(l3.begin(), l3.end(), c) );
+        REQUIRE( std::equal(l3.rbegin(), l3.rend(), std::list<int>(c, c + 12).rbegin()) );
+    }
+}
+
+TEST_CASE("unrolled_list reverse", "[unrolled_list][operations]")
+{
+    std::list<std::string> ref;
+    small_list l;
+    l.reverse();
+    REQUIRE( l.empty() );
+    for (int i = 0; i < 23; ++i) {
+        ref.push_back(make_string(i));
+        l.push_back(make_string(i));
+        if (i % 5 == 0) {
+            // uneven nodes
+            l.insert(l.begin(), make_string(-i));
+            ref.push_front(make_string(-i));
+        }
+        l.reverse();
+        ref.reverse();
+        REQUIRE( same(l, ref) );
+    }
+}
+
+TEST_CASE("unrolled_list emplaces & moves its elements", "[unrolled_list][modifiers]")
+{
+    ft::unrolled_list<std::unique_ptr<int>, 4> l;
+    for (int i = 0; i < 20; ++i)
+        l.emplace_back(new int(i));
+    l.emplace_front(new int(-1));
+    l.emplace(++l.begin(), new int(-2));
+    l.push_back(std::unique_ptr<int>(new int(20)));
+    REQUIRE( l.size() == 23 );
+    REQUIRE( *l.front() == -1 );
+    REQUIRE( **++l.begin() == -2 );
+    REQUIRE( *l.back() == 20 );
+
+    l.sort([](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a > *b; });
+    REQUIRE( *l.front() == 20 );
+    REQUIRE( *l.back() == -2 );
+    l.remove_if([](const std::unique_ptr<int>& p) { return *p < 10; });
+    REQUIRE( l.size() == 11 );
+    REQUIRE( *l.back() == 10 );
+}
+
+#endif
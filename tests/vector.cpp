@@ -2,6 +2,8 @@
 #include "catch.hpp"
 #include <vector>
 #include <list>
+#include <memory>
+#include <stdexcept>
 
 #ifdef VERIFY_UNIT_TESTS
 # define LIB std
@@ -610,3 +612,293 @@ TEMPLATE_PRODUCT_TEST_CASE("size returns updated vector size", "[vector][capacit
     v.clear();
     REQUIRE( v.size() == 0 );
 }
+
+TEST_CASE("vector moves & emplaces elements", "[vector][modifiers]")
+{
+    SECTION("move construction & assignment steal the buffer") {
+        LIB::vector<std::string> src (10, "forty two");
+        const std::string * data = &src[0];
+        LIB::vector<std::string> dst (std::move(src));
+        REQUIRE( src.empty() );
+        REQUIRE( dst.size() == 10 );
+        REQUIRE( &dst[0] == data );
+
+        LIB::vector<std::string> other (3, "x");
+        other = std::move(dst);
+        REQUIRE( other.size() == 10 );
+        REQUIRE( &other[0] == data );
+    }
+    SECTION("move only types can be pushed, emplaced & relocated") {
+        LIB::vector<std::unique_ptr<int> > cnt;
+        for (int i = 0; i < 50; ++i) {
+            if (i % 2)
+                cnt.push_back(std::unique_ptr<int>(new int(i)));
+            else
+                cnt.emplace_back(new int(i));
+        }
+        cnt.emplace(cnt.begin(), new int(-1));
+        cnt.insert(cnt.begin() + 25, std::unique_ptr<int>(new int(-2)));
+        REQUIRE( cnt.size() == 52 );
+        REQUIRE( *cnt[0] == -1 );
+        REQUIRE( *cnt[1] == 0 );
+        REQUIRE( *cnt[25] == -2 );
+        REQUIRE( *cnt[26] == 24 );
+        REQUIRE( *cnt.back() == 49 );
+    }
+    SECTION("emplace_back may take an element of the vector") {
+        LIB::vector<std::string> cnt (1, "forty two");
+        for (int i = 0; i < 10; ++i)
+            cnt.emplace_back(cnt[0]);
+        REQUIRE( cnt.size() == 11 );
+        REQUIRE( cnt.back() == "forty two" );
+    }
+}
+
+template <class T> T make_value (int i);
+template <> inline int make_value<int> (int i) { return i; }
+template <> inline std::string make_value<std::string> (int i) { return std::string(i, 'x'); }
+
+TEMPLATE_TEST_CASE("insert & erase shift elements like the stl", "[vector][modifiers]", int, std::string)
+{
+    LIB::vector<TestType> my_cnt;
+    std::vector<TestType> stl_cnt;
+    for (int i = 0; i < 20; ++i) {
+        my_cnt.push_back(make_value<TestType>(i));
+        stl_cnt.push_back(make_value<TestType>(i));
+    }
+    size_t pos = GENERATE(0, 1, 10, 19, 20);
+    size_t n = GENERATE(1, 3, 40);
+
+    SECTION("fill insert, including an element of the vector itself") {
+        my_cnt.insert(my_cnt.begin() + pos, n, my_cnt[pos % my_cnt.size()]);
+        stl_cnt.insert(stl_cnt.begin() + pos, n, stl_cnt[pos % stl_cnt.size()]);
+    }
+    SECTION("range insert") {
+        std::vector<TestType> src (n, make_value<TestType>(7));
+        my_cnt.insert(my_cnt.begin() + pos, src.begin(), src.end());
+        stl_cnt.insert(stl_cnt.begin() + pos, src.begin(), src.end());
+    }
+    SECTION("range erase") {
+        size_t last = std::min(pos + n, my_cnt.size());
+        my_cnt.erase(my_cnt.begin() + pos, my_cnt.begin() + last);
+        stl_cnt.erase(stl_cnt.begin() + pos, stl_cnt.begin() + last);
+    }
+    REQUIRE( my_cnt.size() == stl_cnt.size() );
+    for (size_t i = 0; i < stl_cnt.size(); ++i)
+        REQUIRE( my_cnt[i] == stl_cnt[i] );
+}
+
+// copying one throws once copies_left reaches 0, moving never throws
+struct brittle
+{
+    static int copies_left;
+    static int alive;
+    int n;
+
+    brittle (int i = 0) : n(i) { ++alive; }
+    brittle (const brittle& x) : n(x.n)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("brittle");
+        ++alive;
+    }
+    brittle (brittle&& x) noexcept : n(x.n) { ++alive; }
+    brittle& operator= (const brittle& x) { n = x.n; return *this; }
+    ~brittle() { --alive; }
+};
+
+int brittle::copies_left = 0;
+int brittle::alive = 0;
+
+TEST_CASE("vector insert leaves no hole when a copy throws", "[vector][modifiers]")
+{
+    // the inserted elements fit in place or go to a new buffer
+    size_t capacity = GENERATE(10, 20);
+    brittle::copies_left = 1000;
+    {
+        LIB::vector<brittle> cnt;
+        cnt.reserve(capacity);
+        for (int i = 0; i < 10; ++i)
+            cnt.push_back(brittle(i));
+        brittle val (42);
+        std::list<brittle> src (5, val);
+
+        SECTION("fill insert") {
+            brittle::copies_left = 2;
+            REQUIRE_THROWS_AS( cnt.insert(cnt.begin() + 8, 5, val), std::runtime_error );
+        }
+        SECTION("range insert") {
+            brittle::copies_left = 2;
+            REQUIRE_THROWS_AS( cnt.insert(cnt.begin() + 8, src.begin(), src.end()), std::runtime_error );
+        }
+        REQUIRE( brittle::alive == static_cast<int>(cnt.size() + src.size() + 1) );
+        brittle::copies_left = 1000;
+#ifndef VERIFY_UNIT_TESTS
+        REQUIRE( cnt.size() == 10 );
+        for (int i = 0; i < 10; ++i)
+            REQUIRE( cnt[i].n == i );
+#endif
+        size_t size = cnt.size();
+        cnt.insert(cnt.begin() + 8, 5, val);
+        REQUIRE( cnt.size() == size + 5 );
+        REQUIRE( cnt[8].n == 42 );
+    }
+    REQUIRE( brittle::alive == 0 );
+}
+
+// written before move semantics, its copies are all the vector can use to
+// move it & they may throw
+struct legacy_value
+{
+    static int copies_left;
+    static int alive;
+    int n;
+
+    legacy_value (int i = 0) : n(i) { ++alive; }
+    legacy_value (const legacy_value& x) : n(x.n)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("legacy_value");
+        ++alive;
+    }
+    legacy_value& operator= (const legacy_value& x) { n = x.n; return *this; }
+    ~legacy_value() { --alive; }
+};
+
+int legacy_value::copies_left = 0;
+int legacy_value::alive = 0;
+
+TEST_CASE("vector reallocation keeps the elements when a copy throws", "[vector][modifiers]")
+{
+    legacy_value::copies_left = 1000;
+    {
+        LIB::vector<legacy_value> cnt;
+        for (int i = 0; i < 10; ++i)
+            cnt.push_back(legacy_value(i));
+        while (cnt.size() < cnt.capacity())
+            cnt.push_back(legacy_value(int(cnt.size())));
+        size_t size = cnt.size();
+        legacy_value val (42);
+
+        SECTION("reserve") {
+            legacy_value::copies_left = 4;
+            REQUIRE_THROWS_AS( cnt.reserve(cnt.capacity() + 1), std::runtime_error );
+        }
+        SECTION("push_back") {
+            legacy_value::copies_left = 4;
+            REQUIRE_THROWS_AS( cnt.push_back(val), std::runtime_error );
+        }
+#ifndef VERIFY_UNIT_TESTS
+        SECTION("insert") {
+            legacy_value::copies_left = 7;
+            REQUIRE_THROWS_AS( cnt.insert(cnt.begin() + 5, 2, val), std::runtime_error );
+        }
+        SECTION("insert in place") {
+            cnt.pop_back();
+            --size;
+            legacy_value::copies_left = 3;
+            REQUIRE_THROWS_AS( cnt.insert(cnt.begin() + 5, val), std::runtime_error );
+        }
+#endif
+        REQUIRE( legacy_value::alive == static_cast<int>(size + 1) );
+        REQUIRE( cnt.size() == size );
+        for (size_t i = 0; i < size; ++i)
+            REQUIRE( cnt[i].n == static_cast<int>(i) );
+
+        legacy_value::copies_left = 1000;
+        cnt.insert(cnt.begin() + 5, val);
+        REQUIRE( cnt.size() == size + 1 );
+        REQUIRE( cnt[5].n == 42 );
+        REQUIRE( cnt[6].n == 5 );
+    }
+    REQUIRE( legacy_value::alive == 0 );
+}
+
+#ifndef VERIFY_UNIT_TESTS
+// owns its int through a pointer, which is all that has to be copied to
+// move it around
+struct handle
+{
+    int * p;
+
+    handle (int i = 0) : p(new int(i)) {}
+    handle (const handle& other) : p(new int(*other.p)) {}
+    handle& operator= (const handle& other) { *p = *other.p; return *this; }
+    ~handle() { delete p; }
+};
+
+namespace ft {
+template <>
+struct is_trivially_relocatable<handle>
+{
+    static const bool value = true;
+};
+}
+
+TEST_CASE("trivially relocatable types are moved with their bytes", "[vector][modifiers]")
+{
+    ft::vector<handle> cnt;
+    std::vector<int> stl_cnt;
+    for (int i = 0; i < 100; ++i) {
+        cnt.push_back(handle(i));
+        stl_cnt.push_back(i);
+    }
+    const int * first = cnt[0].p;
+    cnt.reserve(1000);
+    REQUIRE( cnt[0].p == first );
+
+    cnt.insert(cnt.begin() + 10, 5, handle(-1));
+    stl_cnt.insert(stl_cnt.begin() + 10, 5, -1);
+    cnt.erase(cnt.begin(), cnt.begin() + 3);
+    stl_cnt.erase(stl_cnt.begin(), stl_cnt.begin() + 3);
+    REQUIRE( cnt.size() == stl_cnt.size() );
+    for (size_t i = 0; i < stl_cnt.size(); ++i)
+        REQUIRE( *cnt[i].p == stl_cnt[i] );
+}
+#endif
+
+#ifndef VERIFY_UNIT_TESTS
+template <class Vector>
+std::vector<size_t> capacities (int n)
+{
+    Vector vec;
+    std::vector<size_t> ret;
+    for (int i = 0; i < n; ++i) {
+        vec.push_back(i);
+        if (ret.empty() || ret.back() != vec.capacity())
+            ret.push_back(vec.capacity());
+    }
+    for (int i = 0; i < n; ++i)
+        REQUIRE( vec[i] == i );
+    return ret;
+}
+
+TEST_CASE("growth policies pick the new capacity", "[vector][capacity]")
+{
+    SECTION("the default policy grows by 1.5 starting from 1") {
+        size_t expected[] = { 1, 2, 3, 5, 8, 12, 18, 27, 41, 62, 93 };
+        REQUIRE( capacities<ft::vector<int> >(80) == std::vector<size_t>(expected, expected + 11) );
+    }
+    SECTION("doubling_growth doubles the capacity") {
+        size_t expected[] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+        REQUIRE( capacities<ft::vector<int, std::allocator<int>, ft::doubling_growth> >(100) == std::vector<size_t>(expected, expected + 8) );
+    }
+    SECTION("golden_growth grows by 13/8") {
+        size_t expected[] = { 1, 2, 4, 7, 12, 20, 33, 54, 88, 143 };
+        REQUIRE( capacities<ft::vector<int, std::allocator<int>, ft::golden_growth> >(100) == std::vector<size_t>(expected, expected + 10) );
+    }
+    SECTION("page_growth fills whole pages") {
+        std::vector<size_t> caps = capacities<ft::vector<double, std::allocator<double>, ft::page_growth<> > >(5000);
+        REQUIRE( caps.front() == 4096 / sizeof(double) );
+        for (size_t i = 0; i < caps.size(); ++i)
+            REQUIRE( caps[i] * sizeof(double) % 4096 == 0 );
+    }
+    SECTION("a policy cannot shrink the capacity below the requested size") {
+        ft::vector<int, std::allocator<int>, ft::doubling_growth> vec (3, 42);
+        vec.reserve(1000);
+        REQUIRE( vec.capacity() >= 1000 );
+        vec.insert(vec.end(), 5000, 1);
+        REQUIRE( vec.capacity() >= vec.size() );
+    }
+}
+#endif